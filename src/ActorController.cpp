@@ -0,0 +1,165 @@
+/*
+ * ActorController.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "ActorController.h"
+
+#include <math.h>
+
+// Stop decays the velocity by a quarter each step until it is below this.
+static const float StopThreshold = 0.01f;
+
+ActorController::ActorController()
+{
+}
+
+int ActorController::add(DynamicHawkBody* actor)
+{
+    ASSERT(actor->body());
+
+    m_actors.push_back(actor);
+    m_mass.push_back(actor->body()->GetMass());
+    m_impulseX.push_back(0);
+    m_impulseY.push_back(0);
+
+    Axis* axes[] = { &m_x, &m_y };
+    float speeds[] = { actor->speed().x, actor->speed().y };
+    float bursts[] = { actor->burst().x, actor->burst().y };
+    for (int i = 0; i < 2; ++i) {
+        Axis& axis = *axes[i];
+        axis.movement.push_back(DynamicHawkBody::Coast);
+        axis.speed.push_back(speeds[i]);
+        axis.burst.push_back(bursts[i]);
+        axis.scale.push_back(1);
+        axis.offset.push_back(0);
+        axis.velocity.push_back(0);
+        axis.desired.push_back(0);
+    }
+
+    return m_actors.size() - 1;
+}
+
+void ActorController::clear()
+{
+    m_actors.clear();
+    m_mass.clear();
+    m_impulseX.clear();
+    m_impulseY.clear();
+
+    Axis* axes[] = { &m_x, &m_y };
+    for (int i = 0; i < 2; ++i) {
+        axes[i]->movement.clear();
+        axes[i]->speed.clear();
+        axes[i]->burst.clear();
+        axes[i]->scale.clear();
+        axes[i]->offset.clear();
+        axes[i]->velocity.clear();
+        axes[i]->desired.clear();
+    }
+}
+
+void ActorController::refreshMass(int index)
+{
+    m_mass[index] = m_actors[index]->body()->GetMass();
+}
+
+void ActorController::setHorizontalMovement(int index, Movement movement)
+{
+    setMovement(m_x, index, movement);
+}
+
+void ActorController::setVerticalMovement(int index, Movement movement)
+{
+    setMovement(m_y, index, movement);
+}
+
+// Encode the movement as desired = scale * current + offset.
+void ActorController::setMovement(Axis& axis, int index, Movement movement)
+{
+    axis.movement[index] = movement;
+
+    float scale = 0, offset = 0;
+    switch (movement) {
+    case DynamicHawkBody::Coast:
+        scale = 1;
+        break;
+    case DynamicHawkBody::Stop:
+        scale = -0.25f;
+        break;
+    case DynamicHawkBody::NegativeCruise:
+        offset = -axis.speed[index];
+        break;
+    case DynamicHawkBody::PositiveCruise:
+        offset = axis.speed[index];
+        break;
+    case DynamicHawkBody::NegativeBurst:
+        offset = -axis.burst[index];
+        break;
+    case DynamicHawkBody::PositiveBurst:
+        offset = axis.burst[index];
+        break;
+    }
+
+    axis.scale[index] = scale;
+    axis.offset[index] = offset;
+}
+
+// Bursts fire once and a Stop ends once slow enough; both fall back to Coast.
+void ActorController::settle(Axis& axis)
+{
+    const int count = m_actors.size();
+    for (int i = 0; i < count; ++i) {
+        unsigned char movement = axis.movement[i];
+        if (movement == DynamicHawkBody::NegativeBurst || movement == DynamicHawkBody::PositiveBurst
+            || (movement == DynamicHawkBody::Stop && fabsf(axis.desired[i]) < StopThreshold))
+            setMovement(axis, i, DynamicHawkBody::Coast);
+    }
+}
+
+void ActorController::applyImpulses()
+{
+    const int count = m_actors.size();
+    if (!count)
+        return;
+
+    float* velocityX = &m_x.velocity[0];
+    float* velocityY = &m_y.velocity[0];
+    for (int i = 0; i < count; ++i) {
+        const b2Vec2& velocity = m_actors[i]->body()->GetLinearVelocity();
+        velocityX[i] = velocity.x;
+        velocityY[i] = velocity.y;
+    }
+
+    const float* scaleX = &m_x.scale[0];
+    const float* scaleY = &m_y.scale[0];
+    const float* offsetX = &m_x.offset[0];
+    const float* offsetY = &m_y.offset[0];
+    const float* mass = &m_mass[0];
+    float* desiredX = &m_x.desired[0];
+    float* desiredY = &m_y.desired[0];
+    float* impulseX = &m_impulseX[0];
+    float* impulseY = &m_impulseY[0];
+
+    // No branches or calls, so the compiler can vectorize this loop.
+    for (int i = 0; i < count; ++i) {
+        float dx = scaleX[i] * velocityX[i] + offsetX[i];
+        float dy = scaleY[i] * velocityY[i] + offsetY[i];
+        float active = (dx * dx + dy * dy) > 0 ? mass[i] : 0.f;
+        desiredX[i] = dx;
+        desiredY[i] = dy;
+        impulseX[i] = (dx - velocityX[i]) * active;
+        impulseY[i] = (dy - velocityY[i]) * active;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (impulseX[i] == 0 && impulseY[i] == 0)
+            continue;
+        b2Body* body = m_actors[i]->body();
+        body->ApplyLinearImpulse(HawkVector(impulseX[i], impulseY[i]), body->GetWorldCenter(), true);
+    }
+
+    settle(m_x);
+    settle(m_y);
+}
@@ -0,0 +1,72 @@
+/*
+ * ActorController.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef ACTORCONTROLLER_H_
+#define ACTORCONTROLLER_H_
+
+#include "HawkBody.h"
+
+#include <vector>
+
+class ActorController {
+public:
+    /**
+     * Moves many DynamicHawkBody actors at once.
+     *
+     * Movement state, speed/burst and velocities live in parallel arrays. Every
+     * movement reduces to desired = scale * current + offset per axis, so the
+     * impulse computation is one branch-free loop over all actors. Impulses are
+     * then applied in a single pass before the world steps.
+     *
+     * Actors added here are driven by the controller only; do not also call their
+     * own applyImpulses(). The controller does not own the bodies.
+     */
+    ActorController();
+
+    typedef DynamicHawkBody::Movement Movement;
+
+    // Returns the actor's index, stable until clear().
+    int add(DynamicHawkBody*);
+    void clear();
+
+    int size() const { return m_actors.size(); }
+    DynamicHawkBody* actor(int index) const { return m_actors[index]; }
+
+    void setHorizontalMovement(int index, Movement);
+    void setVerticalMovement(int index, Movement);
+    Movement horizontalMovement(int index) const { return static_cast<Movement>(m_x.movement[index]); }
+    Movement verticalMovement(int index) const { return static_cast<Movement>(m_y.movement[index]); }
+
+    // Re-reads masses after an actor's fixtures change.
+    void refreshMass(int index);
+
+    // Same rules as DynamicHawkBody::applyImpulses, for every actor.
+    void applyImpulses();
+
+private:
+    struct Axis {
+        std::vector<unsigned char> movement;
+        std::vector<float> speed;
+        std::vector<float> burst;
+        std::vector<float> scale;
+        std::vector<float> offset;
+        std::vector<float> velocity;
+        std::vector<float> desired;
+    };
+
+    void setMovement(Axis&, int index, Movement);
+    void settle(Axis&);
+
+    std::vector<DynamicHawkBody*> m_actors;
+    std::vector<float> m_mass;
+    std::vector<float> m_impulseX;
+    std::vector<float> m_impulseY;
+
+    Axis m_x;
+    Axis m_y;
+};
+
+#endif /* ACTORCONTROLLER_H_ */
@@ -0,0 +1,33 @@
+/*
+ * AudioDecoder.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "AudioDecoder.h"
+#include "VorbisReader.h"
+#include "WavReader.h"
+
+#include <string.h>
+#include <strings.h>
+
+AudioDecoder* AudioDecoder::create(const char* fileName)
+{
+    AudioDecoder* decoder;
+    if (isVorbis(fileName))
+        decoder = new VorbisReader;
+    else
+        decoder = new WavReader;
+
+    if (!decoder->open(fileName)) {
+        delete decoder;
+        return 0;
+    }
+    return decoder;
+}
+
+bool AudioDecoder::isVorbis(const char* fileName)
+{
+    size_t length = strlen(fileName);
+    return length >= 4 && !strcasecmp(fileName + length - 4, ".ogg");
+}
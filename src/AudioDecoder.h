@@ -0,0 +1,45 @@
+/*
+ * AudioDecoder.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef AUDIODECODER_H_
+#define AUDIODECODER_H_
+
+#include <AL/al.h>
+
+class AudioDecoder {
+public:
+    /**
+     * Turns a sound file into PCM a piece at a time, whatever its encoding.
+     *
+     * Streams pull one buffer's worth at a time through read(); clips read until
+     * the end. Implementations produce whole sample frames in an OpenAL format.
+     */
+    virtual ~AudioDecoder() { }
+
+    virtual bool open(const char* fileName) = 0;
+    virtual void close() = 0;
+    virtual bool isOpen() const = 0;
+
+    virtual ALenum format() const = 0;
+    virtual ALsizei frequency() const = 0;
+
+    /**
+     * Decodes up to size bytes of PCM into buffer, rounded down to whole sample
+     * frames. Returns the bytes written, 0 at the end of the data and -1 on error.
+     */
+    virtual int read(void* buffer, int size) = 0;
+
+    // Goes back to the first sample.
+    virtual bool rewind() = 0;
+
+    // An opened decoder for fileName, chosen by its extension, or 0.
+    static AudioDecoder* create(const char* fileName);
+
+    // Whether fileName is Ogg Vorbis rather than WAV, by its extension.
+    static bool isVorbis(const char* fileName);
+};
+
+#endif /* AUDIODECODER_H_ */
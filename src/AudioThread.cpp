@@ -0,0 +1,127 @@
+/*
+ * AudioThread.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "AudioThread.h"
+#include "Sound.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+// How long the audio thread sleeps between passes, in microseconds. Well under
+// the length of one stream buffer, and short enough not to delay effects.
+static const useconds_t Period = 5000;
+
+AudioThread::AudioThread()
+    : m_head(0)
+    , m_tail(0)
+    , m_running(false)
+    , m_quit(false)
+    , m_dropped(0)
+{
+}
+
+AudioThread::~AudioThread()
+{
+    stop();
+}
+
+void AudioThread::add(Sound* sound)
+{
+    sound->m_audio = this;
+    if (sound->isStreamed())
+        m_streams.push_back(sound);
+}
+
+bool AudioThread::start()
+{
+    if (m_running)
+        return true;
+
+    m_quit = false;
+    if (pthread_create(&m_thread, 0, run, this)) {
+        fprintf(stderr, "Cannot start the audio thread\n");
+        return false;
+    }
+    m_running = true;
+    return true;
+}
+
+void AudioThread::stop()
+{
+    if (!m_running)
+        return;
+
+    m_quit = true;
+    pthread_join(m_thread, 0);
+    m_running = false;
+}
+
+bool AudioThread::post(const AudioCommand& command)
+{
+    // Without the thread, commands run right away on the caller's thread.
+    if (!m_running) {
+        execute(command);
+        return true;
+    }
+
+    unsigned head = m_head;
+    if (head - m_tail == QueueSize) {
+        ++m_dropped;
+        return false;
+    }
+
+    m_queue[head % QueueSize] = command;
+    // The command must be visible before the head moves past it.
+    __sync_synchronize();
+    m_head = head + 1;
+    return true;
+}
+
+void* AudioThread::run(void* self)
+{
+    static_cast<AudioThread*>(self)->loop();
+    return 0;
+}
+
+void AudioThread::loop()
+{
+    for (;;) {
+        unsigned head = m_head;
+        __sync_synchronize();
+        for (unsigned tail = m_tail; tail != head; ++tail) {
+            execute(m_queue[tail % QueueSize]);
+            // The slot must be read before the game thread may reuse it.
+            __sync_synchronize();
+            m_tail = tail + 1;
+        }
+
+        for (unsigned i = 0; i < m_streams.size(); ++i)
+            m_streams[i]->tick();
+
+        // Commands posted before stop() still run.
+        if (m_quit && m_tail == m_head)
+            break;
+        usleep(Period);
+    }
+}
+
+void AudioThread::execute(const AudioCommand& command)
+{
+    switch (command.type) {
+    case AudioCommand::Play:
+        command.sound->playNow(command.gain);
+        break;
+    case AudioCommand::Pause:
+        command.sound->pauseNow();
+        break;
+    case AudioCommand::Stop:
+        command.sound->stopNow();
+        break;
+    case AudioCommand::SetGain:
+        command.sound->setGainNow(command.gain);
+        break;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * AudioThread.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef AUDIOTHREAD_H_
+#define AUDIOTHREAD_H_
+
+#include <pthread.h>
+
+#include <vector>
+
+class Sound;
+
+struct AudioCommand {
+    enum Type { Play, Pause, Stop, SetGain };
+
+    Type type;
+    const Sound* sound;
+    float gain;
+};
+
+class AudioThread {
+public:
+    /**
+     * Runs every OpenAL call made while the game is playing on a thread of its own.
+     *
+     * Sounds added with add() post their play(), pause(), stop() and setGain()
+     * calls here instead of calling OpenAL. The commands go through a fixed-size
+     * single-producer, single-consumer ring, so posting never locks or allocates;
+     * only the game thread may post. The audio thread drains the ring and keeps
+     * streamed sounds fed every few milliseconds, however long a frame takes.
+     *
+     * Sounds are loaded and unloaded on the game thread while the audio thread is
+     * not running: add() everything before start(), and stop() before unloading.
+     */
+    AudioThread();
+    ~AudioThread();
+
+    void add(Sound*);
+
+    bool start();
+    void stop();
+    bool isRunning() const { return m_running; }
+
+    // Game thread only. Returns false, dropping the command, when the ring is full.
+    bool post(const AudioCommand&);
+
+    int droppedCount() const { return m_dropped; }
+
+private:
+    enum { QueueSize = 256 };
+
+    static void* run(void*);
+    void loop();
+    void execute(const AudioCommand&);
+
+    // m_head is only written by the game thread and m_tail only by the audio
+    // thread; the difference is the number of queued commands.
+    AudioCommand m_queue[QueueSize];
+    volatile unsigned m_head;
+    volatile unsigned m_tail;
+
+    std::vector<Sound*> m_streams;
+
+    pthread_t m_thread;
+    volatile bool m_running;
+    volatile bool m_quit;
+    int m_dropped;
+};
+
+#endif /* AUDIOTHREAD_H_ */
@@ -0,0 +1,117 @@
+/*
+ * BlockSpawner.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "BlockSpawner.h"
+
+#include <GLES/gl.h>
+#include <math.h>
+
+static const unsigned InitialSeed = 0x2545f491;
+
+BlockSpawner::BlockSpawner()
+    : m_interval(0)
+    , m_left(0)
+    , m_right(0)
+    , m_spawnY(0)
+    , m_killPlane(-200.f)
+    , m_elapsed(0)
+    , m_spawned(0)
+    , m_seed(InitialSeed)
+{
+    m_sprites.smallBelligerent = m_sprites.smallResting = 0;
+    m_sprites.largeBelligerent = m_sprites.largeResting = 0;
+    m_sprites.smallShape = m_sprites.largeShape = 0;
+}
+
+void BlockSpawner::create(b2World* world, const Sprites& sprites, int smallCount, int largeCount)
+{
+    m_sprites = sprites;
+
+    DynamicHawkBodyDef def;
+    def.world = world;
+    def.speed = HawkVector(0, 0);
+    def.burst = HawkVector(0, 0);
+    def.fixedRotation = false;
+    def.categoryBits = BlockCategory;
+
+    m_small.create(def, sprites.smallBelligerent, smallCount, sprites.smallShape);
+    m_large.create(def, sprites.largeBelligerent, largeCount, sprites.largeShape);
+}
+
+void BlockSpawner::setSchedule(float interval, float left, float right, float y)
+{
+    m_interval = interval;
+    m_left = left;
+    m_right = right;
+    m_spawnY = y;
+}
+
+DynamicHawkBody* BlockSpawner::spawn(float x, float y)
+{
+    // Every third block is a large one, if any are left.
+    BodyPool& preferred = (m_spawned % 3 == 2) ? m_large : m_small;
+    BodyPool& fallback = (&preferred == &m_large) ? m_small : m_large;
+
+    DynamicHawkBody* block = preferred.acquire(HawkPoint(x, y));
+    if (!block)
+        block = fallback.acquire(HawkPoint(x, y));
+    if (block)
+        ++m_spawned;
+    return block;
+}
+
+void BlockSpawner::update(float dt)
+{
+    m_small.releaseBelow(m_killPlane);
+    m_large.releaseBelow(m_killPlane);
+
+    if (m_interval <= 0)
+        return;
+
+    m_elapsed += dt;
+    while (m_elapsed >= m_interval) {
+        m_elapsed -= m_interval;
+
+        // Deterministic so world checksums stay comparable between runs.
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 17;
+        m_seed ^= m_seed << 5;
+        float x = m_left + (m_right - m_left) * (m_seed % 1000) / 1000.f;
+        spawn(x, m_spawnY);
+    }
+}
+
+void BlockSpawner::reset()
+{
+    m_small.releaseAll();
+    m_large.releaseAll();
+    m_elapsed = 0;
+    m_spawned = 0;
+    m_seed = InitialSeed;
+}
+
+void BlockSpawner::drawPool(BodyPool& pool, Sprite* belligerent, Sprite* resting, const SpriteShape* shape)
+{
+    for (int i = 0; i < pool.activeCount(); ++i) {
+        DynamicHawkBody* block = pool.active(i);
+        b2Body* body = block->body();
+
+        block->useSprite(body->IsAwake() ? belligerent : resting, shape);
+
+        glPushMatrix();
+        HawkPoint position = Hawk::toPixels(body->GetPosition());
+        glTranslatef(position.x, position.y, 0);
+        glRotatef((180 * body->GetAngle() / M_PI), 0.0f, 0.0f, 1.0f);
+        block->draw();
+        glPopMatrix();
+    }
+}
+
+void BlockSpawner::draw()
+{
+    drawPool(m_small, m_sprites.smallBelligerent, m_sprites.smallResting, m_sprites.smallShape);
+    drawPool(m_large, m_sprites.largeBelligerent, m_sprites.largeResting, m_sprites.largeShape);
+}
@@ -0,0 +1,69 @@
+/*
+ * BlockSpawner.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef BLOCKSPAWNER_H_
+#define BLOCKSPAWNER_H_
+
+#include "BodyPool.h"
+
+class BlockSpawner {
+public:
+    /**
+     * Drops small and large blocks on a schedule from pooled bodies.
+     *
+     * Blocks are drawn with their belligerent sprite while awake and their resting
+     * sprite once Box2D puts them to sleep. Blocks that fall below the kill plane
+     * return to their pool. All positions are in pixels.
+     */
+    BlockSpawner();
+
+    struct Sprites {
+        Sprite* smallBelligerent;
+        Sprite* smallResting;
+        Sprite* largeBelligerent;
+        Sprite* largeResting;
+        const SpriteShape* smallShape;
+        const SpriteShape* largeShape;
+    };
+
+    void create(b2World*, const Sprites&, int smallCount, int largeCount);
+
+    // Spawn a block every interval seconds at a random x in [left, right] at height y.
+    void setSchedule(float interval, float left, float right, float y);
+    void setKillPlane(float y) { m_killPlane = y; }
+
+    // Spawns immediately, alternating sizes. Returns 0 when both pools are exhausted.
+    DynamicHawkBody* spawn(float x, float y);
+
+    // Advances the schedule by dt seconds and recycles fallen blocks.
+    void update(float dt);
+
+    // Returns every block to its pool and restarts the schedule.
+    void reset();
+
+    void draw();
+
+    int activeCount() const { return m_small.activeCount() + m_large.activeCount(); }
+
+private:
+    void drawPool(BodyPool&, Sprite* belligerent, Sprite* resting, const SpriteShape*);
+
+    BodyPool m_small;
+    BodyPool m_large;
+    Sprites m_sprites;
+
+    float m_interval;
+    float m_left;
+    float m_right;
+    float m_spawnY;
+    float m_killPlane;
+
+    float m_elapsed;
+    unsigned m_spawned;
+    unsigned m_seed;
+};
+
+#endif /* BLOCKSPAWNER_H_ */
@@ -0,0 +1,112 @@
+/*
+ * BodyPool.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "BodyPool.h"
+
+#include <algorithm>
+
+BodyPool::BodyPool()
+{
+}
+
+BodyPool::~BodyPool()
+{
+    destroy();
+}
+
+void BodyPool::create(const DynamicHawkBodyDef& def, Sprite* sprite, int count, const SpriteShape* shape)
+{
+    m_bodies.reserve(m_bodies.size() + count);
+    m_free.reserve(m_free.capacity() + count);
+    m_active.reserve(m_active.capacity() + count);
+
+    for (int i = 0; i < count; ++i) {
+        DynamicHawkBody* body = new DynamicHawkBody(def);
+        body->useSprite(sprite, shape);
+        body->createBody(HawkPoint(0, 0));
+        body->createFixtureFromSprite();
+        body->body()->SetActive(false);
+
+        m_bodies.push_back(body);
+        m_free.push_back(body);
+    }
+}
+
+void BodyPool::destroy()
+{
+    for (unsigned i = 0; i < m_bodies.size(); ++i) {
+        m_bodies[i]->destroyBody();
+        delete m_bodies[i];
+    }
+    m_bodies.clear();
+    m_free.clear();
+    m_active.clear();
+}
+
+DynamicHawkBody* BodyPool::acquire(const HawkPoint& position, float angle)
+{
+    if (m_free.empty())
+        return 0;
+
+    DynamicHawkBody* hawkBody = m_free.back();
+    m_free.pop_back();
+    m_active.push_back(hawkBody);
+
+    b2Body* body = hawkBody->body();
+    body->SetTransform(Hawk::toMeters(position), angle);
+    body->SetLinearVelocity(HawkVector(0, 0));
+    body->SetAngularVelocity(0);
+    body->SetActive(true);
+    body->SetAwake(true);
+
+    hawkBody->setHorizontalMovement(DynamicHawkBody::Coast);
+    hawkBody->setVerticalMovement(DynamicHawkBody::Coast);
+    return hawkBody;
+}
+
+void BodyPool::deactivate(DynamicHawkBody* hawkBody)
+{
+    hawkBody->body()->SetActive(false);
+    m_free.push_back(hawkBody);
+}
+
+void BodyPool::release(DynamicHawkBody* hawkBody)
+{
+    std::vector<DynamicHawkBody*>::iterator it = std::find(m_active.begin(), m_active.end(), hawkBody);
+    if (it == m_active.end())
+        return;
+
+    *it = m_active.back();
+    m_active.pop_back();
+    deactivate(hawkBody);
+}
+
+void BodyPool::releaseAll()
+{
+    for (unsigned i = 0; i < m_active.size(); ++i)
+        deactivate(m_active[i]);
+    m_active.clear();
+}
+
+int BodyPool::releaseBelow(float y)
+{
+    const float limit = Hawk::pix2M(y);
+    int released = 0;
+
+    for (unsigned i = 0; i < m_active.size();) {
+        DynamicHawkBody* hawkBody = m_active[i];
+        if (hawkBody->body()->GetPosition().y >= limit) {
+            ++i;
+            continue;
+        }
+
+        m_active[i] = m_active.back();
+        m_active.pop_back();
+        deactivate(hawkBody);
+        ++released;
+    }
+    return released;
+}
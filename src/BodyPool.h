@@ -0,0 +1,52 @@
+/*
+ * BodyPool.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef BODYPOOL_H_
+#define BODYPOOL_H_
+
+#include "HawkBody.h"
+
+#include <vector>
+
+class BodyPool {
+public:
+    /**
+     * A fixed set of DynamicHawkBody objects created up front and recycled.
+     *
+     * Every body is created once with its fixture and parked inactive. acquire()
+     * moves one into place and activates it; release() deactivates it again.
+     * Inactive bodies have no broadphase proxies or contacts, so they cost nothing
+     * in b2World::Step, and nothing is allocated or freed while playing.
+     */
+    BodyPool();
+    ~BodyPool();
+
+    // Creates count bodies sharing sprite, with fixtures from its traced shape
+    // when one is given. Positions are in pixels.
+    void create(const DynamicHawkBodyDef&, Sprite* sprite, int count, const SpriteShape* shape = 0);
+    void destroy();
+
+    // Returns 0 when every body is in use.
+    DynamicHawkBody* acquire(const HawkPoint& position, float angle = 0);
+    void release(DynamicHawkBody*);
+    void releaseAll();
+
+    // Releases active bodies whose centre is below y (pixels). Returns how many.
+    int releaseBelow(float y);
+
+    int capacity() const { return m_bodies.size(); }
+    int activeCount() const { return m_active.size(); }
+    DynamicHawkBody* active(int index) const { return m_active[index]; }
+
+private:
+    void deactivate(DynamicHawkBody*);
+
+    std::vector<DynamicHawkBody*> m_bodies;
+    std::vector<DynamicHawkBody*> m_free;
+    std::vector<DynamicHawkBody*> m_active;
+};
+
+#endif /* BODYPOOL_H_ */
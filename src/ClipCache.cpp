@@ -0,0 +1,243 @@
+/*
+ * ClipCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "ClipCache.h"
+#include "AudioDecoder.h"
+#include "MappedWav.h"
+#include "VoicePool.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+// Decoded clips grow by this much at a time.
+static const int DecodeChunkSize = 64 * 1024;
+
+// PCM ready to go into a buffer: either in place in a mapped WAV or decoded.
+struct PendingClip {
+    PendingClip()
+        : fileName(0)
+        , format(0)
+        , frequency(0)
+        , data(0)
+        , size(0)
+    { }
+
+    const char* fileName;
+    MappedWav wav;
+    std::vector<char> decoded;
+
+    ALenum format;
+    ALsizei frequency;
+    const void* data;
+    ALsizei size;
+};
+
+// Makes no AL calls, so loader threads can run it.
+static bool readClip(const char* fileName, PendingClip& clip, bool prefault)
+{
+    clip.fileName = fileName;
+
+    if (!AudioDecoder::isVorbis(fileName)) {
+        if (!clip.wav.open(fileName))
+            return false;
+        if (prefault)
+            clip.wav.prefault();
+        clip.format = clip.wav.format();
+        clip.frequency = clip.wav.frequency();
+        clip.data = clip.wav.data();
+        clip.size = clip.wav.size();
+        return true;
+    }
+
+    AudioDecoder* decoder = AudioDecoder::create(fileName);
+    if (!decoder)
+        return false;
+
+    std::vector<char>& data = clip.decoded;
+    for (;;) {
+        size_t size = data.size();
+        data.resize(size + DecodeChunkSize);
+        int count = decoder->read(&data[size], DecodeChunkSize);
+        if (count <= 0) {
+            data.resize(size);
+            if (count < 0) {
+                fprintf(stderr, "Cannot decode %s\n", fileName);
+                delete decoder;
+                return false;
+            }
+            break;
+        }
+        data.resize(size + count);
+    }
+
+    clip.format = decoder->format();
+    clip.frequency = decoder->frequency();
+    clip.data = data.empty() ? 0 : &data[0];
+    clip.size = data.size();
+    delete decoder;
+    return true;
+}
+
+namespace {
+
+struct PreloadContext {
+    PendingClip* clips;
+    bool* loaded;
+    int count;
+    int next;
+};
+
+}
+
+static void* preloadWorker(void* data)
+{
+    PreloadContext* context = static_cast<PreloadContext*>(data);
+    for (;;) {
+        int index = __sync_fetch_and_add(&context->next, 1);
+        if (index >= context->count)
+            break;
+        context->loaded[index] = readClip(context->clips[index].fileName, context->clips[index], true);
+    }
+    return 0;
+}
+
+ClipCache::ClipCache(VoicePool& voices)
+    : m_voices(voices)
+    , m_bytes(0)
+{
+}
+
+ClipCache::~ClipCache()
+{
+    for (std::map<std::string, Clip>::iterator it = m_clips.begin(); it != m_clips.end(); ++it) {
+        m_voices.stop(it->second.buffer);
+        alDeleteBuffers(1, &it->second.buffer);
+    }
+}
+
+ALuint ClipCache::acquire(const char* fileName)
+{
+    std::map<std::string, Clip>::iterator found = m_clips.find(fileName);
+    if (found != m_clips.end()) {
+        ++found->second.references;
+        return found->second.buffer;
+    }
+
+    PendingClip pending;
+    if (!readClip(fileName, pending, false))
+        return 0;
+
+    ALuint buffer = upload(fileName, pending);
+    if (!buffer)
+        return 0;
+
+    Clip clip = { buffer, 1, pending.size };
+    m_clips.insert(std::make_pair(std::string(fileName), clip));
+    m_bytes += pending.size;
+    return buffer;
+}
+
+int ClipCache::preload(const char* const* fileNames, int count, int threadCount)
+{
+    if (count <= 0)
+        return 0;
+
+    PendingClip* clips = new PendingClip[count];
+    bool* loaded = new bool[count];
+    PreloadContext context = { clips, loaded, 0, 0 };
+
+    // Files already cached only need another reference.
+    int cached = 0;
+    for (int i = 0; i < count; ++i) {
+        std::map<std::string, Clip>::iterator found = m_clips.find(fileNames[i]);
+        if (found != m_clips.end()) {
+            ++found->second.references;
+            ++cached;
+            continue;
+        }
+        clips[context.count++].fileName = fileNames[i];
+    }
+
+    threadCount = std::max(1, std::min(threadCount, context.count));
+    std::vector<pthread_t> threads(threadCount);
+    int started = 0;
+    for (int i = 0; i < threadCount && context.count; ++i) {
+        if (pthread_create(&threads[started], 0, preloadWorker, &context))
+            break;
+        ++started;
+    }
+    // Whatever the threads did not get to is loaded here.
+    preloadWorker(&context);
+    for (int i = 0; i < started; ++i)
+        pthread_join(threads[i], 0);
+
+    // Buffers are filled on this thread; only the file work ran in parallel.
+    for (int i = 0; i < context.count; ++i) {
+        const char* fileName = clips[i].fileName;
+        std::map<std::string, Clip>::iterator found = m_clips.find(fileName);
+        if (found != m_clips.end()) {
+            // The same file was listed twice.
+            ++found->second.references;
+            ++cached;
+            continue;
+        }
+
+        ALuint buffer = loaded[i] ? upload(fileName, clips[i]) : 0;
+        if (!buffer)
+            continue;
+        Clip clip = { buffer, 1, clips[i].size };
+        m_clips.insert(std::make_pair(std::string(fileName), clip));
+        m_bytes += clips[i].size;
+        ++cached;
+    }
+
+    delete[] loaded;
+    delete[] clips;
+    return cached;
+}
+
+void ClipCache::release(ALuint buffer)
+{
+    for (std::map<std::string, Clip>::iterator it = m_clips.begin(); it != m_clips.end(); ++it) {
+        Clip& clip = it->second;
+        if (clip.buffer != buffer)
+            continue;
+
+        if (--clip.references == 0) {
+            m_voices.stop(buffer);
+            alDeleteBuffers(1, &clip.buffer);
+            m_bytes -= clip.bytes;
+            m_clips.erase(it);
+        }
+        return;
+    }
+}
+
+ALuint ClipCache::upload(const char* fileName, const PendingClip& pending)
+{
+    if (!pending.size) {
+        fprintf(stderr, "%s has no samples\n", fileName);
+        return 0;
+    }
+
+    // Clear old AL error
+    alGetError();
+    ALuint buffer = 0;
+    alGenBuffers(1, &buffer);
+    alBufferData(buffer, pending.format, pending.data, pending.size, pending.frequency);
+
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot copy %s into a buffer: %d\n", fileName, error);
+        if (buffer)
+            alDeleteBuffers(1, &buffer);
+        return 0;
+    }
+    return buffer;
+}
@@ -0,0 +1,65 @@
+/*
+ * ClipCache.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef CLIPCACHE_H_
+#define CLIPCACHE_H_
+
+#include <AL/al.h>
+
+#include <map>
+#include <string>
+
+class VoicePool;
+struct PendingClip;
+
+class ClipCache {
+public:
+    /**
+     * Decoded sound effects, one AL buffer per file however many sounds use it.
+     *
+     * acquire() loads a file on first use and hands out the same buffer to every
+     * later caller, counting references. WAV files are mapped and copied into
+     * the buffer straight from the mapping; Ogg Vorbis files are decoded whole.
+     * The buffer is deleted when the last reference is released, after any
+     * voices still playing it are stopped. Clips are played through the given
+     * pool, which must outlive the cache.
+     */
+    ClipCache(VoicePool& voices);
+    ~ClipCache();
+
+    // The buffer holding fileName, or 0 if it cannot be loaded. Pair with release().
+    ALuint acquire(const char* fileName);
+    void release(ALuint buffer);
+
+    /**
+     * Loads several files at once: up to threadCount threads map or decode them
+     * and read them from disk, then their buffers are filled here. Each file
+     * gets one reference, held until release() or the cache is destroyed, so
+     * later acquire() calls for them are only lookups. Returns how many of the
+     * files are cached afterwards.
+     */
+    int preload(const char* const* fileNames, int count, int threadCount = 4);
+
+    VoicePool& voices() const { return m_voices; }
+
+    int clipCount() const { return m_clips.size(); }
+    long byteSize() const { return m_bytes; }
+
+private:
+    struct Clip {
+        ALuint buffer;
+        int references;
+        long bytes;
+    };
+
+    ALuint upload(const char* fileName, const PendingClip&);
+
+    VoicePool& m_voices;
+    std::map<std::string, Clip> m_clips;
+    long m_bytes;
+};
+
+#endif /* CLIPCACHE_H_ */
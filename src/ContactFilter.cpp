@@ -0,0 +1,53 @@
+/*
+ * ContactFilter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "ContactFilter.h"
+
+ContactFilter::ContactFilter()
+    : m_sensorMask(0xFFFF)
+{
+    for (int i = 0; i < CategoryCount; ++i)
+        m_ignored[i] = 0;
+}
+
+void ContactFilter::ignore(uint16 categoriesA, uint16 categoriesB)
+{
+    for (int i = 0; i < CategoryCount; ++i) {
+        if (categoriesA & (1 << i))
+            m_ignored[i] |= categoriesB;
+        if (categoriesB & (1 << i))
+            m_ignored[i] |= categoriesA;
+    }
+}
+
+bool ContactFilter::ignores(uint16 categoriesA, uint16 categoriesB) const
+{
+    // Fixtures normally have a single category, so this is usually one iteration.
+    for (int i = 0; categoriesA; ++i, categoriesA >>= 1) {
+        if ((categoriesA & 1) && (m_ignored[i] & categoriesB))
+            return true;
+    }
+    return false;
+}
+
+bool ContactFilter::ShouldCollide(b2Fixture* fixtureA, b2Fixture* fixtureB)
+{
+    const b2Filter& filterA = fixtureA->GetFilterData();
+    const b2Filter& filterB = fixtureB->GetFilterData();
+
+    if (filterA.groupIndex == filterB.groupIndex && filterA.groupIndex)
+        return filterA.groupIndex > 0;
+
+    if (!(filterA.maskBits & filterB.categoryBits) || !(filterB.maskBits & filterA.categoryBits))
+        return false;
+
+    if (fixtureA->IsSensor() && !(filterB.categoryBits & m_sensorMask))
+        return false;
+    if (fixtureB->IsSensor() && !(filterA.categoryBits & m_sensorMask))
+        return false;
+
+    return !ignores(filterA.categoryBits, filterB.categoryBits);
+}
@@ -0,0 +1,42 @@
+/*
+ * ContactFilter.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef CONTACTFILTER_H_
+#define CONTACTFILTER_H_
+
+#include "HawkEngine.h"
+
+class ContactFilter : public b2ContactFilter {
+public:
+    /**
+     * Category/mask/group filtering plus layer rules that apply to whole categories,
+     * such as debris ignoring debris or sensors only seeing the player.
+     *
+     * Box2D asks the filter when the broadphase first pairs two fixtures, so every
+     * pair rejected here never reaches the narrowphase.
+     */
+    ContactFilter();
+    virtual ~ContactFilter() { }
+
+    // Fixtures in categoriesA never collide with fixtures in categoriesB (and vice versa).
+    void ignore(uint16 categoriesA, uint16 categoriesB);
+
+    // Sensor fixtures only report fixtures in these categories.
+    void setSensorMask(uint16 categories) { m_sensorMask = categories; }
+
+    virtual bool ShouldCollide(b2Fixture*, b2Fixture*);
+
+private:
+    enum { CategoryCount = 16 };
+
+    bool ignores(uint16 categoriesA, uint16 categoriesB) const;
+
+    // For each category bit, the categories it ignores.
+    uint16 m_ignored[CategoryCount];
+    uint16 m_sensorMask;
+};
+
+#endif /* CONTACTFILTER_H_ */
@@ -0,0 +1,168 @@
+/*
+ * ContactListener.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "ContactListener.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+
+static unsigned hashContact(const b2Contact* contact)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(contact);
+    return static_cast<unsigned>((key >> 4) ^ (key >> 12));
+}
+
+static bool samePair(const ContactEvent& a, const ContactEvent& b)
+{
+    return a.bodyA == b.bodyA && a.bodyB == b.bodyB;
+}
+
+static bool lessByPair(const ContactEvent& a, const ContactEvent& b)
+{
+    return a.bodyA < b.bodyA || (a.bodyA == b.bodyA && a.bodyB < b.bodyB);
+}
+
+static bool greaterByImpulse(const ContactEvent& a, const ContactEvent& b)
+{
+    return a.impulse > b.impulse;
+}
+
+ContactListener::ContactListener()
+    : m_eventCount(0)
+    , m_dropped(0)
+    , m_droppedLastStep(0)
+    , m_triggerCount(0)
+    , m_impulseThreshold(1.0f)
+    , m_maxEventsPerFrame(8)
+{
+    memset(m_slots, 0, sizeof(m_slots));
+}
+
+int ContactListener::find(const b2Contact* contact) const
+{
+    for (unsigned i = hashContact(contact); ; ++i) {
+        const Slot& slot = m_slots[i % HashSize];
+        if (!slot.contact)
+            return -1;
+        if (slot.contact == contact)
+            return slot.event;
+    }
+}
+
+void ContactListener::BeginContact(b2Contact* contact)
+{
+    b2Fixture* fixtureA = contact->GetFixtureA();
+    b2Fixture* fixtureB = contact->GetFixtureB();
+    if (fixtureA->IsSensor() != fixtureB->IsSensor()) {
+        if (fixtureA->IsSensor())
+            recordTrigger(fixtureA, fixtureB, true);
+        else
+            recordTrigger(fixtureB, fixtureA, true);
+        return;
+    }
+    if (fixtureA->IsSensor())
+        return;
+
+    if (m_eventCount == MaxEventsPerStep) {
+        ++m_dropped;
+        return;
+    }
+
+    // The table is never more than half full, so probing always finds a free slot.
+    unsigned i = hashContact(contact);
+    while (m_slots[i % HashSize].contact)
+        ++i;
+
+    ContactEvent& event = m_events[m_eventCount];
+    event.bodyA = std::min(fixtureA->GetBody(), fixtureB->GetBody());
+    event.bodyB = std::max(fixtureA->GetBody(), fixtureB->GetBody());
+    event.impulse = 0;
+
+    m_slots[i % HashSize].contact = contact;
+    m_slots[i % HashSize].event = m_eventCount++;
+}
+
+void ContactListener::EndContact(b2Contact* contact)
+{
+    b2Fixture* fixtureA = contact->GetFixtureA();
+    b2Fixture* fixtureB = contact->GetFixtureB();
+    if (fixtureA->IsSensor() == fixtureB->IsSensor())
+        return;
+
+    if (fixtureA->IsSensor())
+        recordTrigger(fixtureA, fixtureB, false);
+    else
+        recordTrigger(fixtureB, fixtureA, false);
+}
+
+void ContactListener::recordTrigger(b2Fixture* sensor, b2Fixture* other, bool began)
+{
+    if (m_triggerCount == MaxTriggersPerStep) {
+        ++m_dropped;
+        return;
+    }
+
+    TriggerEvent& event = m_triggers[m_triggerCount++];
+    event.sensor = sensor;
+    event.body = other->GetBody();
+    event.began = began;
+}
+
+void ContactListener::PostSolve(b2Contact* contact, const b2ContactImpulse* impulse)
+{
+    // Only contacts that began this step are of interest; the rest miss the table.
+    if (!m_eventCount)
+        return;
+
+    int index = find(contact);
+    if (index < 0)
+        return;
+
+    float strongest = 0;
+    for (int i = 0; i < impulse->count; ++i)
+        strongest = std::max(strongest, impulse->normalImpulses[i]);
+
+    ContactEvent& event = m_events[index];
+    event.impulse = std::max(event.impulse, strongest);
+}
+
+int ContactListener::processEvents()
+{
+    int count = 0;
+    for (int i = 0; i < m_eventCount; ++i) {
+        if (m_events[i].impulse >= m_impulseThreshold)
+            m_batch[count++] = m_events[i];
+    }
+
+    // Several fixtures of the same two bodies make one event with the strongest impulse.
+    std::sort(m_batch, m_batch + count, lessByPair);
+    int unique = 0;
+    for (int i = 0; i < count; ++i) {
+        if (unique && samePair(m_batch[unique - 1], m_batch[i]))
+            m_batch[unique - 1].impulse = std::max(m_batch[unique - 1].impulse, m_batch[i].impulse);
+        else
+            m_batch[unique++] = m_batch[i];
+    }
+
+    std::sort(m_batch, m_batch + unique, greaterByImpulse);
+
+    if (m_eventCount)
+        memset(m_slots, 0, sizeof(m_slots));
+    m_eventCount = 0;
+    m_droppedLastStep = m_dropped;
+    m_dropped = 0;
+
+    return std::min(unique, m_maxEventsPerFrame);
+}
+
+int ContactListener::processTriggers()
+{
+    int count = m_triggerCount;
+    memcpy(m_triggerBatch, m_triggers, count * sizeof(TriggerEvent));
+    m_triggerCount = 0;
+    return count;
+}
@@ -0,0 +1,102 @@
+/*
+ * ContactListener.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef CONTACTLISTENER_H_
+#define CONTACTLISTENER_H_
+
+#include "HawkEngine.h"
+
+// A new contact between two bodies, coalesced over one step.
+struct ContactEvent {
+    b2Body* bodyA;
+    b2Body* bodyB;
+
+    // Largest normal impulse the solver applied on the step the contact began.
+    float impulse;
+};
+
+// A body entering or leaving a sensor fixture, collected over one step.
+struct TriggerEvent {
+    b2Fixture* sensor;
+
+    // Only compare this against known bodies: an exit is also reported when the
+    // body is destroyed, so it may no longer exist when the batch is handled.
+    b2Body* body;
+
+    bool began;
+};
+
+class ContactListener : public b2ContactListener {
+public:
+    /**
+     * Records contacts while b2World::Step runs and hands them out afterwards.
+     *
+     * Nothing but bookkeeping happens inside the solver callbacks. Events go into
+     * a fixed buffer; contacts beyond its capacity are dropped for that step.
+     * processEvents() is called once after Step to build the frame's batch.
+     *
+     * Overlaps with sensor fixtures are kept apart as trigger events, so zone
+     * logic only sees the bodies that actually crossed a sensor boundary.
+     */
+    ContactListener();
+    virtual ~ContactListener() { }
+
+    enum { MaxEventsPerStep = 256, MaxTriggersPerStep = 64 };
+
+    // Contacts whose impulse is below the threshold are dropped when processed.
+    void setImpulseThreshold(float threshold) { m_impulseThreshold = threshold; }
+
+    // Upper bound on the batch returned from processEvents, strongest first.
+    void setMaxEventsPerFrame(int count) { m_maxEventsPerFrame = count < MaxEventsPerStep ? count : MaxEventsPerStep; }
+
+    virtual void BeginContact(b2Contact*);
+    virtual void EndContact(b2Contact*);
+    virtual void PostSolve(b2Contact*, const b2ContactImpulse*);
+
+    /**
+     * Deduplicates the step's contacts per body pair, drops weak ones and caps the
+     * count. Returns the number of events; the events stay valid until the next call.
+     */
+    int processEvents();
+    const ContactEvent* events() const { return m_batch; }
+
+    // Contacts and triggers lost to a full buffer during the last processed step.
+    int droppedEvents() const { return m_droppedLastStep; }
+
+    /**
+     * Hands out the sensor enters and exits recorded since the last call, in the
+     * order they happened. The events stay valid until the next call.
+     */
+    int processTriggers();
+    const TriggerEvent* triggers() const { return m_triggerBatch; }
+
+private:
+    enum { HashSize = MaxEventsPerStep * 2 };
+
+    int find(const b2Contact*) const;
+    void recordTrigger(b2Fixture* sensor, b2Fixture* other, bool began);
+
+    struct Slot {
+        const b2Contact* contact;
+        int event;
+    };
+
+    ContactEvent m_events[MaxEventsPerStep];
+    ContactEvent m_batch[MaxEventsPerStep];
+    Slot m_slots[HashSize];
+    int m_eventCount;
+    int m_dropped;
+    int m_droppedLastStep;
+
+    TriggerEvent m_triggers[MaxTriggersPerStep];
+    TriggerEvent m_triggerBatch[MaxTriggersPerStep];
+    int m_triggerCount;
+
+    float m_impulseThreshold;
+    int m_maxEventsPerFrame;
+};
+
+#endif /* CONTACTLISTENER_H_ */
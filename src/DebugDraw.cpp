@@ -0,0 +1,151 @@
+/*
+ * DebugDraw.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "DebugDraw.h"
+
+#include <math.h>
+
+static const int CircleSegments = 16;
+
+// Length of a drawn contact normal and of the body axes, in metres.
+static const float NormalLength = 0.2f;
+static const float AxisLength = 0.3f;
+
+static void appendColor(std::vector<GLubyte>& colors, const b2Color& color)
+{
+    colors.push_back(static_cast<GLubyte>(color.r * 255));
+    colors.push_back(static_cast<GLubyte>(color.g * 255));
+    colors.push_back(static_cast<GLubyte>(color.b * 255));
+    colors.push_back(255);
+}
+
+DebugDraw::DebugDraw()
+{
+    SetFlags(e_shapeBit | e_aabbBit | e_centerOfMassBit | ContactBit);
+}
+
+void DebugDraw::addLine(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color)
+{
+    m_lineVertices.push_back(p1.x);
+    m_lineVertices.push_back(p1.y);
+    m_lineVertices.push_back(p2.x);
+    m_lineVertices.push_back(p2.y);
+    appendColor(m_lineColors, color);
+    appendColor(m_lineColors, color);
+}
+
+void DebugDraw::addPoint(const b2Vec2& point, const b2Color& color)
+{
+    m_pointVertices.push_back(point.x);
+    m_pointVertices.push_back(point.y);
+    appendColor(m_pointColors, color);
+}
+
+void DebugDraw::DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
+{
+    for (int32 i = 0; i < vertexCount; ++i)
+        addLine(vertices[i], vertices[(i + 1) % vertexCount], color);
+}
+
+// Outlines only; filling would cost overdraw for nothing.
+void DebugDraw::DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
+{
+    DrawPolygon(vertices, vertexCount, color);
+}
+
+void DebugDraw::DrawCircle(const b2Vec2& center, float32 radius, const b2Color& color)
+{
+    b2Vec2 previous = center + b2Vec2(radius, 0);
+    for (int i = 1; i <= CircleSegments; ++i) {
+        float angle = 2 * b2_pi * i / CircleSegments;
+        b2Vec2 next = center + b2Vec2(radius * cosf(angle), radius * sinf(angle));
+        addLine(previous, next, color);
+        previous = next;
+    }
+}
+
+void DebugDraw::DrawSolidCircle(const b2Vec2& center, float32 radius, const b2Vec2& axis, const b2Color& color)
+{
+    DrawCircle(center, radius, color);
+    addLine(center, center + radius * axis, color);
+}
+
+void DebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color)
+{
+    addLine(p1, p2, color);
+}
+
+void DebugDraw::DrawTransform(const b2Transform& transform)
+{
+    addLine(transform.p, transform.p + AxisLength * transform.q.GetXAxis(), b2Color(1, 0, 0));
+    addLine(transform.p, transform.p + AxisLength * transform.q.GetYAxis(), b2Color(0, 1, 0));
+    addPoint(transform.p, b2Color(1, 1, 1));
+}
+
+void DebugDraw::addContacts(b2World* world)
+{
+    const b2Color pointColor(1, 0.2f, 0.2f);
+    const b2Color normalColor(1, 1, 0.2f);
+
+    for (b2Contact* contact = world->GetContactList(); contact; contact = contact->GetNext()) {
+        if (!contact->IsTouching())
+            continue;
+
+        int count = contact->GetManifold()->pointCount;
+        b2WorldManifold manifold;
+        contact->GetWorldManifold(&manifold);
+        for (int i = 0; i < count; ++i) {
+            addPoint(manifold.points[i], pointColor);
+            addLine(manifold.points[i], manifold.points[i] + NormalLength * manifold.normal, normalColor);
+        }
+    }
+}
+
+void DebugDraw::render(b2World* world)
+{
+    m_lineVertices.clear();
+    m_lineColors.clear();
+    m_pointVertices.clear();
+    m_pointColors.clear();
+
+    world->SetDebugDraw(this);
+    world->DrawDebugData();
+    world->SetDebugDraw(0);
+    if (GetFlags() & ContactBit)
+        addContacts(world);
+
+    flush();
+}
+
+void DebugDraw::flush()
+{
+    glDisable(GL_TEXTURE_2D);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glPushMatrix();
+    glScalef(Hawk::m2Pix(1.f), Hawk::m2Pix(1.f), 1.0f);
+
+    if (!m_lineVertices.empty()) {
+        glVertexPointer(2, GL_FLOAT, 0, &m_lineVertices[0]);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, &m_lineColors[0]);
+        glDrawArrays(GL_LINES, 0, m_lineVertices.size() / 2);
+    }
+
+    if (!m_pointVertices.empty()) {
+        glPointSize(4.0f);
+        glVertexPointer(2, GL_FLOAT, 0, &m_pointVertices[0]);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, &m_pointColors[0]);
+        glDrawArrays(GL_POINTS, 0, m_pointVertices.size() / 2);
+    }
+
+    glPopMatrix();
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnable(GL_TEXTURE_2D);
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+}
@@ -0,0 +1,59 @@
+/*
+ * DebugDraw.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef DEBUGDRAW_H_
+#define DEBUGDRAW_H_
+
+#include "HawkEngine.h"
+
+#include <GLES/gl.h>
+
+#include <vector>
+
+class DebugDraw : public b2Draw {
+public:
+    /**
+     * Draws what Box2D sees over the game, for diagnosing physics on the device.
+     *
+     * b2World::DrawDebugData() and the contact list are collected into one line
+     * batch and one point batch, so a frame costs two draw calls however busy the
+     * world is. Box2D picks body colours: awake dynamic bodies are pink, sleeping
+     * ones grey, static ones green and kinematic ones blue. Broadphase AABBs are
+     * purple. Touching contacts are red points with yellow normals.
+     *
+     * Call render() with the modelview in screen pixels and textured sprites
+     * enabled, as renderGame leaves them; it puts that state back when done.
+     */
+    DebugDraw();
+
+    enum { ContactBit = 0x1000 };
+
+    void render(b2World*);
+
+    int lineCount() const { return m_lineVertices.size() / 4; }
+    int pointCount() const { return m_pointVertices.size() / 2; }
+
+    virtual void DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color&);
+    virtual void DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color&);
+    virtual void DrawCircle(const b2Vec2& center, float32 radius, const b2Color&);
+    virtual void DrawSolidCircle(const b2Vec2& center, float32 radius, const b2Vec2& axis, const b2Color&);
+    virtual void DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color&);
+    virtual void DrawTransform(const b2Transform&);
+
+private:
+    void addLine(const b2Vec2& p1, const b2Vec2& p2, const b2Color&);
+    void addPoint(const b2Vec2&, const b2Color&);
+    void addContacts(b2World*);
+    void flush();
+
+    // Metres; the batch is scaled to pixels when drawn.
+    std::vector<GLfloat> m_lineVertices;
+    std::vector<GLubyte> m_lineColors;
+    std::vector<GLfloat> m_pointVertices;
+    std::vector<GLubyte> m_pointColors;
+};
+
+#endif /* DEBUGDRAW_H_ */
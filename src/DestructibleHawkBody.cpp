@@ -0,0 +1,192 @@
+/*
+ * DestructibleHawkBody.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "DestructibleHawkBody.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+DestructibleHawkBody::DestructibleHawkBody(const DestructibleHawkBodyDef& def)
+    : HawkBody(def)
+    , m_maxCellSize(def.cellSize > 1 ? def.cellSize : 1)
+    , m_columns(0)
+    , m_rows(0)
+    , m_cellWidth(0)
+    , m_cellHeight(0)
+    , m_filledCells(0)
+    , m_dirtyRows(0)
+    , m_meshDirty(true)
+{
+}
+
+void DestructibleHawkBody::createFixturesFromGrid()
+{
+    if (width() <= 0 || height() <= 0)
+        return;
+
+    m_columns = std::max(1, static_cast<int>(ceilf(width() / m_maxCellSize)));
+    m_rows = std::max(1, static_cast<int>(ceilf(height() / m_maxCellSize)));
+    m_cellWidth = width() / m_columns;
+    m_cellHeight = height() / m_rows;
+
+    m_rowFixtures.resize(m_rows);
+    restore();
+}
+
+void DestructibleHawkBody::restore()
+{
+    m_cells.assign(m_columns * m_rows, 1);
+    m_filledCells = m_cells.size();
+    m_rowDirty.assign(m_rows, 1);
+    m_dirtyRows = m_rows;
+    m_meshDirty = true;
+    rebuildDirtyRows(m_rows);
+}
+
+HawkPoint DestructibleHawkBody::cellCenter(int column, int row) const
+{
+    return HawkPoint((column + 0.5f) * m_cellWidth - width() / 2, (row + 0.5f) * m_cellHeight - height() / 2);
+}
+
+int DestructibleHawkBody::carve(const HawkPoint& center, float radius, std::vector<HawkPoint>* removed)
+{
+    if (!m_body || m_cells.empty())
+        return 0;
+
+    HawkPoint local = Hawk::toPixels(m_body->GetLocalPoint(Hawk::toMeters(center)));
+
+    // Only the cells under the circle's bounding box are looked at.
+    int firstColumn = std::max(0, static_cast<int>(floorf((local.x - radius + width() / 2) / m_cellWidth)));
+    int lastColumn = std::min(m_columns - 1, static_cast<int>(floorf((local.x + radius + width() / 2) / m_cellWidth)));
+    int firstRow = std::max(0, static_cast<int>(floorf((local.y - radius + height() / 2) / m_cellHeight)));
+    int lastRow = std::min(m_rows - 1, static_cast<int>(floorf((local.y + radius + height() / 2) / m_cellHeight)));
+
+    int count = 0;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            if (!filled(column, row))
+                continue;
+
+            HawkPoint cell = cellCenter(column, row);
+            if ((cell - local).LengthSquared() > radius * radius)
+                continue;
+
+            m_cells[row * m_columns + column] = 0;
+            ++count;
+            if (removed)
+                removed->push_back(Hawk::toPixels(m_body->GetWorldPoint(Hawk::toMeters(cell))));
+
+            if (!m_rowDirty[row]) {
+                m_rowDirty[row] = 1;
+                ++m_dirtyRows;
+            }
+        }
+    }
+
+    m_filledCells -= count;
+    if (count)
+        m_meshDirty = true;
+    return count;
+}
+
+int DestructibleHawkBody::rebuildDirtyRows(int budget)
+{
+    int rebuilt = 0;
+    for (int row = 0; row < m_rows && m_dirtyRows && rebuilt < budget; ++row) {
+        if (!m_rowDirty[row])
+            continue;
+        rebuildRow(row);
+        m_rowDirty[row] = 0;
+        --m_dirtyRows;
+        ++rebuilt;
+    }
+    return rebuilt;
+}
+
+void DestructibleHawkBody::rebuildRow(int row)
+{
+    std::vector<b2Fixture*>& fixtures = m_rowFixtures[row];
+    for (unsigned i = 0; i < fixtures.size(); ++i)
+        m_body->DestroyFixture(fixtures[i]);
+    fixtures.clear();
+
+    b2FixtureDef def;
+    def.density = 5.0f;
+    def.friction = 0.7f;
+    def.filter = m_filter;
+
+    // One box per run of filled cells, so an intact row is a single fixture.
+    for (int column = 0; column < m_columns; ) {
+        if (!filled(column, row)) {
+            ++column;
+            continue;
+        }
+
+        int end = column;
+        while (end < m_columns && filled(end, row))
+            ++end;
+
+        HawkPoint center((column + end) * m_cellWidth / 2 - width() / 2, (row + 0.5f) * m_cellHeight - height() / 2);
+        b2PolygonShape box;
+        box.SetAsBox(Hawk::pix2M((end - column) * m_cellWidth) / 2, Hawk::pix2M(m_cellHeight) / 2, Hawk::toMeters(center), 0);
+        def.shape = &box;
+        fixtures.push_back(m_body->CreateFixture(&def));
+
+        column = end;
+    }
+}
+
+void DestructibleHawkBody::rebuildMesh()
+{
+    m_vertices.clear();
+    m_textureCoordinates.clear();
+
+    Sprite* image = sprite();
+    float textureX = image->TextureWidth() / m_columns;
+    float textureY = image->TextureHeight() / m_rows;
+
+    for (int row = 0; row < m_rows; ++row) {
+        for (int column = 0; column < m_columns; ) {
+            if (!filled(column, row)) {
+                ++column;
+                continue;
+            }
+
+            int end = column;
+            while (end < m_columns && filled(end, row))
+                ++end;
+
+            GLfloat left = column * m_cellWidth - width() / 2;
+            GLfloat right = end * m_cellWidth - width() / 2;
+            GLfloat bottom = row * m_cellHeight - height() / 2;
+            GLfloat top = bottom + m_cellHeight;
+            GLfloat quad[12] = { left, bottom, right, bottom, left, top, left, top, right, bottom, right, top };
+            m_vertices.insert(m_vertices.end(), quad, quad + 12);
+
+            GLfloat s0 = column * textureX, s1 = end * textureX;
+            GLfloat t0 = row * textureY, t1 = (row + 1) * textureY;
+            GLfloat coordinates[12] = { s0, t0, s1, t0, s0, t1, s0, t1, s1, t0, s1, t1 };
+            m_textureCoordinates.insert(m_textureCoordinates.end(), coordinates, coordinates + 12);
+
+            column = end;
+        }
+    }
+    m_meshDirty = false;
+}
+
+void DestructibleHawkBody::draw()
+{
+    if (m_cells.empty()) {
+        HawkBody::draw();
+        return;
+    }
+
+    if (m_meshDirty)
+        rebuildMesh();
+    if (!m_vertices.empty())
+        sprite()->drawTriangles(&m_vertices[0], &m_textureCoordinates[0], m_vertices.size() / 2);
+}
@@ -0,0 +1,91 @@
+/*
+ * DestructibleHawkBody.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef DESTRUCTIBLEHAWKBODY_H_
+#define DESTRUCTIBLEHAWKBODY_H_
+
+#include "HawkBody.h"
+
+#include <vector>
+
+struct DestructibleHawkBodyDef : HawkBodyDef {
+    DestructibleHawkBodyDef()
+        : cellSize(16)
+    { }
+
+    // Largest side of one occupancy cell in pixels. The sprite is split evenly.
+    float cellSize;
+};
+
+class DestructibleHawkBody : public HawkBody {
+public:
+    /**
+     * A static body whose sprite is split into a grid of cells that can be knocked out.
+     *
+     * Each row of the grid is covered by one box fixture per run of filled cells.
+     * carve() only clears cells and marks their rows dirty; the fixtures of dirty
+     * rows are replaced by rebuildDirtyRows(), which takes a row budget so callers
+     * can spread a large hit over several frames. Until then the old fixtures
+     * stay, so the body never has holes the player can fall through mid-frame.
+     *
+     * Positions are in pixels, like the sprite.
+     */
+    DestructibleHawkBody(const DestructibleHawkBodyDef& def);
+    virtual ~DestructibleHawkBody() { }
+
+    virtual DestructibleHawkBody* toDestructible() { return this; }
+
+    // Fills the grid from the sprite size and builds every row. Use instead of
+    // createFixtureFromSprite().
+    void createFixturesFromGrid();
+
+    // Fills every cell again and rebuilds all rows immediately.
+    void restore();
+
+    /**
+     * Clears the cells whose centres are within radius of center, in world pixels.
+     * The world centres of the removed cells are appended to removed when given.
+     * Returns how many cells were removed.
+     */
+    int carve(const HawkPoint& center, float radius, std::vector<HawkPoint>* removed = 0);
+
+    // Rebuilds the fixtures of at most budget dirty rows. Returns the rows rebuilt.
+    int rebuildDirtyRows(int budget);
+    bool hasDirtyRows() const { return m_dirtyRows > 0; }
+    int dirtyRowCount() const { return m_dirtyRows; }
+
+    int cellCount() const { return m_cells.size(); }
+    int filledCellCount() const { return m_filledCells; }
+
+    // Draws only the cells that are left.
+    virtual void draw();
+
+private:
+    bool filled(int column, int row) const { return m_cells[row * m_columns + column]; }
+    HawkPoint cellCenter(int column, int row) const;
+    void rebuildRow(int row);
+    void rebuildMesh();
+
+    float m_maxCellSize;
+    int m_columns;
+    int m_rows;
+    float m_cellWidth;
+    float m_cellHeight;
+
+    std::vector<unsigned char> m_cells;
+    int m_filledCells;
+
+    std::vector<unsigned char> m_rowDirty;
+    int m_dirtyRows;
+    std::vector<std::vector<b2Fixture*> > m_rowFixtures;
+
+    // Two triangles per run of filled cells, rebuilt on the next draw after a carve.
+    bool m_meshDirty;
+    std::vector<GLfloat> m_vertices;
+    std::vector<GLfloat> m_textureCoordinates;
+};
+
+#endif /* DESTRUCTIBLEHAWKBODY_H_ */
@@ -31,6 +31,7 @@
 #include <time.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <algorithm>
 #include <string>
 #include <unistd.h>
 
@@ -42,6 +43,20 @@
 #define LEADERBOARD_LINE_OFFSET_X 30.0f
 #define LEADERBOARD_LINE_OFFSET_Y 30.0f
 
+// A block hitting a platform harder than this, in N·s, knocks a hole of this radius in pixels.
+#define BREAK_IMPULSE 30.0f
+#define BREAK_RADIUS 40.0f
+// Sand grains thrown up per broken cell, and how fast in pixels per second.
+#define SAND_PER_CELL 6
+#define SAND_SPEED 250.0f
+
+// Effect voices, and the contact impulse in N·s that plays the click at full volume.
+#define EFFECT_VOICES 12
+#define CLICK_FULL_IMPULSE 20.0f
+
+// Voices of higher priority are stolen last.
+enum EffectPriority { ContactPriority, BlockPriority, InterfacePriority };
+
 GameLogic::GameLogic(Platform &platform)
     : HawkInputHandler()
     , m_platform(platform)
@@ -53,19 +68,38 @@ GameLogic::GameLogic(Platform &platform)
     , m_resumeTime(0)
     , m_score(0)
     , m_leaderBoardReady(false)
-    , m_timeStep(1.0f / 60.0f)
-    , m_velocityIterations(6)
-    , m_positionIterations(2)
-    , m_world(b2Vec2(0.0f, -10.0f))
+    , m_world(m_worldSettings.gravity)
+    , m_terrainIndex(m_worldSettings.terrainBackend, m_worldSettings.terrainCellSize)
+    , m_triggers(0)
     , m_player(0)
-    , m_contactListener(m_clickReverb)
+    , m_checkpoint(0)
+    , m_checksumEnabled(false)
+    , m_physicsStatsLogEnabled(false)
+    , m_clips(m_voices)
+    , m_debugDrawEnabled(false)
 {
 
-    m_backgroundMusic.load("app/native/background.wav");
-    m_click1.load("app/native/click1.wav");
-    m_click2.load("app/native/click2.wav");
-    m_clickReverb.load("app/native/clickreverb.wav");
-    m_blockFall.load("app/native/blockfall.wav");
+    m_backgroundMusic.stream("app/native/background.wav");
+    // Effects are read from disk in parallel first, so each load() below is a lookup.
+    static const char* const effects[] = {
+        "app/native/click1.wav",
+        "app/native/click2.wav",
+        "app/native/clickreverb.wav",
+        "app/native/blockfall.wav",
+    };
+    m_voices.create(EFFECT_VOICES);
+    m_clips.preload(effects, sizeof(effects) / sizeof(effects[0]));
+    m_click1.load(effects[0], &m_clips, InterfacePriority);
+    m_click2.load(effects[1], &m_clips, InterfacePriority);
+    m_clickReverb.load(effects[2], &m_clips, ContactPriority);
+    m_blockFall.load(effects[3], &m_clips, BlockPriority);
+
+    m_audio.add(&m_backgroundMusic);
+    m_audio.add(&m_click1);
+    m_audio.add(&m_click2);
+    m_audio.add(&m_clickReverb);
+    m_audio.add(&m_blockFall);
+    m_audio.start();
 
     m_platform.setEventHandler(this);
     m_platform.getSize(m_sceneWidth, m_sceneHeight);
@@ -99,6 +133,8 @@ GameLogic::GameLogic(Platform &platform)
     m_smallBlockResting.load("app/native/resting_small.png");
     m_largeBlockBelligerent.load("app/native/belligerent.png");
     m_largeBlockResting.load("app/native/resting.png");
+    m_debris.load("app/native/ground.png");
+    m_debris.setSize(12, 12);
 
     m_background.load("app/native/Background.png");
     m_background.setPosition(m_sceneWidth / 2, m_sceneHeight / 2);
@@ -140,31 +176,43 @@ GameLogic::GameLogic(Platform &platform)
     m_playButton.setPosition(m_sceneWidth / 2, m_leaderBoard.PosY() - m_leaderBoard.Height() / 2);
 
     //Box2D initialization and scene setup
+    m_worldSettings.apply(&m_world);
     m_world.SetContactListener(&m_contactListener);
 
-    DynamicHawkBodyDef def;
-    def.world = &m_world;
-    def.speed = HawkVector(4, 4);
-    def.burst = HawkVector(8, 8);
-    def.fixedRotation = true;
-
-    for (int i = 0; i < 4; ++i) {
-        HawkBody* platform = new HawkBody(def);
-        platform->createSprite("app/native/ground.png");
-
-        HawkPoint center((i * (m_sceneWidth / 4)) + (platform->width() / 2), ((i % 2) * 200) + platform->height());
-        platform->createBody(center);
-        platform->createFixtureFromSprite();
-        m_terrain.push_back(platform);
+    m_contactFilter.ignore(DebrisCategory, DebrisCategory);
+    m_contactFilter.setSensorMask(PlayerCategory);
+    m_world.SetContactFilter(&m_contactFilter);
+
+    m_level.load("app/native/", m_sceneWidth, m_sceneHeight);
+    m_level.createTerrain(&m_world, m_terrain);
+    m_terrainIndex.build(&m_world);
+    m_player = m_level.createPlayer(m_level.playerDef(&m_world));
+    m_triggers = m_level.createTriggers(&m_world, m_player);
+
+    BlockSpawner::Sprites blockSprites;
+    blockSprites.smallBelligerent = &m_smallBlockBelligerent;
+    blockSprites.smallResting = &m_smallBlockResting;
+    blockSprites.largeBelligerent = &m_largeBlockBelligerent;
+    blockSprites.largeResting = &m_largeBlockResting;
+    blockSprites.smallShape = SpriteShape::forSprite("app/native/belligerent_small.png");
+    blockSprites.largeShape = SpriteShape::forSprite("app/native/belligerent.png");
+    m_spawner.create(&m_world, blockSprites, 32, 16);
+    m_spawner.setSchedule(1.5f, m_sceneWidth * 0.1f, m_sceneWidth * 0.9f, m_sceneHeight + 100.f);
+
+    m_destruction.create(&m_world, &m_debris, 64);
+    for (std::list<HawkBody*>::iterator it = m_terrain.begin(); it != m_terrain.end(); ++it) {
+        if (DestructibleHawkBody* destructible = (*it)->toDestructible())
+            m_destruction.add(destructible);
     }
+    m_sand.create(2048, 2.0f);
+    m_sand.setKillPlane(-200.f);
 
-    m_player = new DynamicHawkBody(def);
-    m_player->createSprite("app/native/resting.png");
-
-    HawkPoint center(m_sceneWidth / 2, m_sceneHeight / 2);
-    m_player->createBody(center);
-    m_player->createFixtureFromSprite();
+    m_initialState.capture(&m_world);
 
+    if (const char* checksumLog = getenv("HAWK_CHECKSUM_LOG"))
+        m_checksumEnabled = m_checksum.openLog(checksumLog);
+    if (const char* statsLog = getenv("HAWK_PHYSICS_STATS_LOG"))
+        m_physicsStatsLogEnabled = m_physicsStats.openLog(statsLog);
 }
 
 void GameLogic::enable2D()
@@ -201,7 +249,9 @@ void GameLogic::run()
         // platform handle input
         m_platform.processEvents();
 
-        m_backgroundMusic.tick();
+        // The audio thread keeps the music fed when it runs.
+        if (!m_audio.isRunning())
+            m_backgroundMusic.tick();
 
         switch (m_state) {
         case FetchUser:
@@ -216,6 +266,9 @@ void GameLogic::run()
             break;
         }
     }
+
+    // No more OpenAL calls from the audio thread once main() starts tearing down.
+    m_audio.stop();
 }
 
 void GameLogic::update()
@@ -225,19 +278,97 @@ void GameLogic::update()
     }
 
     m_player->applyImpulses();
-    m_world.Step(m_timeStep, m_velocityIterations, m_positionIterations);
+    m_spawner.update(m_worldSettings.timeStep);
+    if (m_destruction.update(m_worldSettings.timeStep))
+        rebuildTerrainQueries();
+    m_worldSettings.step(&m_world);
+    m_sand.update(m_worldSettings.timeStep, m_world.GetGravity(), m_terrainIndex);
+    if (m_checksumEnabled)
+        m_checksum.record(&m_world);
+    if (m_physicsStatsLogEnabled || m_debugDrawEnabled)
+        m_physicsStats.collect(&m_world);
+
+    // Contacts are only recorded during the step; sound is triggered once for the
+    // batch, as loud as its strongest contact.
+    int contactCount = m_contactListener.processEvents();
+    if (contactCount)
+        m_clickReverb.play(std::min(1.0f, m_contactListener.events()[0].impulse / CLICK_FULL_IMPULSE));
+    breakTerrain(contactCount);
 
     time_t now = m_platform.getCurrentTime();
     m_scoreTime += (now - m_resumeTime);
     m_resumeTime = now;
 
-    HawkPoint position = m_player->body()->GetPosition();
-    if (Hawk::m2Pix(position.y) < -m_player->height()) {
-        endGamePlay(false);
-        return;
+    handleTriggers();
+}
+
+// The batch is strongest first, so this stops at the first contact that is too weak.
+void GameLogic::breakTerrain(int contactCount)
+{
+    const ContactEvent* events = m_contactListener.events();
+    for (int i = 0; i < contactCount && events[i].impulse >= BREAK_IMPULSE; ++i) {
+        b2Body* bodies[2] = { events[i].bodyA, events[i].bodyB };
+        for (int side = 0; side < 2; ++side) {
+            HawkBody* terrain = static_cast<HawkBody*>(bodies[side]->GetUserData());
+            b2Body* other = bodies[1 - side];
+            b2Fixture* otherFixture = other->GetFixtureList();
+            if (!terrain || !terrain->toDestructible() || !otherFixture || !(otherFixture->GetFilterData().categoryBits & BlockCategory))
+                continue;
+
+            HawkPoint center = Hawk::toPixels(other->GetPosition());
+            if (int cells = m_destruction.explode(center, BREAK_RADIUS)) {
+                m_sand.emit(center, SAND_SPEED, cells * SAND_PER_CELL);
+                m_blockFall.play();
+            }
+        }
     }
 }
 
+// Anything holding terrain fixtures or surfaces must be rebuilt after they change.
+void GameLogic::rebuildTerrainQueries()
+{
+    m_terrainIndex.build(&m_world);
+    m_sand.invalidateTerrain();
+}
+
+// Returns true when a zone ended the game.
+bool GameLogic::handleTriggers()
+{
+    int count = m_contactListener.processTriggers();
+    const TriggerEvent* triggers = m_contactListener.triggers();
+
+    for (int i = 0; i < count; ++i) {
+        if (!triggers[i].began || triggers[i].body != m_player->body())
+            continue;
+
+        const TriggerZone* zone = m_level.zone(triggers[i].sensor);
+        if (!zone)
+            continue;
+
+        switch (zone->kind) {
+        case TriggerZone::Goal:
+            endGamePlay(true);
+            return true;
+        case TriggerZone::Kill:
+            if (!m_checkpoint) {
+                endGamePlay(false);
+                return true;
+            }
+            m_player->body()->SetTransform(Hawk::toMeters(m_checkpoint->respawn), 0);
+            m_player->body()->SetLinearVelocity(HawkVector(0, 0));
+            m_player->setHorizontalMovement(DynamicHawkBody::Coast);
+            m_player->setVerticalMovement(DynamicHawkBody::Coast);
+            break;
+        case TriggerZone::Checkpoint:
+            m_checkpoint = zone;
+            break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
 void GameLogic::renderFetchUser()
 {
     m_platform.beginRender();
@@ -305,6 +436,10 @@ void GameLogic::renderGame()
     glPopMatrix();
 
 
+    m_spawner.draw();
+    m_destruction.draw();
+    m_sand.draw();
+
     glPushMatrix();
     HawkPoint position = Hawk::toPixels(m_player->body()->GetPosition());
     glTranslatef(position.x, position.y, 0);
@@ -312,6 +447,8 @@ void GameLogic::renderGame()
     m_player->draw();
     glPopMatrix();
 
+    if (m_debugDrawEnabled)
+        m_debugDraw.render(&m_world);
 
     glDisableClientState(GL_VERTEX_ARRAY);
     glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -324,6 +461,12 @@ void GameLogic::renderGame()
 
     bbutil_render_text(m_scoreFont, buf, m_scorePosX, m_scorePosY, 0.75f, 0.75f, 0.75f, 1.0f);
 
+    if (m_debugDrawEnabled) {
+        char stats[160];
+        m_physicsStats.format(stats, sizeof(stats));
+        bbutil_render_text(m_leaderboardFont, stats, 10.0f, 10.0f, 0.0f, 1.0f, 0.0f, 1.0f);
+    }
+
     m_platform.finishRender();
 }
 
@@ -401,9 +544,21 @@ void GameLogic::endGamePlay(bool win)
 
 void GameLogic::reset()
 {
-    m_player->destroyBody();
-    m_player->createBody(HawkPoint(m_sceneWidth / 2, m_sceneHeight / 2));
-    m_player->createFixtureFromSprite();
+    // Put every body back where it started without recreating anything. Only if
+    // bodies were added or removed since the capture is the player rebuilt.
+    m_spawner.reset();
+    m_destruction.reset();
+    m_sand.clear();
+    rebuildTerrainQueries();
+    m_checkpoint = 0;
+    if (!m_initialState.restore(&m_world)) {
+        m_player->destroyBody();
+        m_player->createBody(m_level.spawnPoint());
+        m_player->createFixtureFromSprite();
+        m_player->setHorizontalMovement(DynamicHawkBody::Coast);
+        m_player->setVerticalMovement(DynamicHawkBody::Coast);
+        m_initialState.capture(&m_world);
+    }
 
     //Initialize shape list
     m_state = GamePlay;
@@ -416,6 +571,12 @@ void GameLogic::reset()
     m_resumeTime = m_platform.getCurrentTime();
 }
 
+void GameLogic::addNextShape(float x, float y)
+{
+    if (m_spawner.spawn(x, y))
+        m_blockFall.play();
+}
+
 void GameLogic::onLeftRelease(float x, float y)
 {
     if (m_state == LeaderBoard && m_leaderBoardReady) {
@@ -551,23 +712,15 @@ void GameLogic::onControlStarted(HawkControl control)
         m_playButton.textY++;
         m_click1.play();
     } else if (m_state == GamePlay) {
-        if (!m_gamePaused) {
+        if (!m_gamePaused && !m_player->startControl(control)) {
             switch (control) {
-            case MoveLeft:
-                m_player->setHorizontalMovement(DynamicHawkBody::NegativeCruise);
-                break;
-            case MoveRight:
-                m_player->setHorizontalMovement(DynamicHawkBody::PositiveCruise);
-                break;
-            case ActionA:
-                m_player->setVerticalMovement(DynamicHawkBody::PositiveBurst);
+            case Menu2:
+                onPause();
                 break;
-            case ActionB:
-            case ActionX:
             case ActionY:
+                m_debugDrawEnabled = !m_debugDrawEnabled;
                 break;
-            case Menu2:
-                onPause();
+            default:
                 break;
             }
         }
@@ -585,23 +738,13 @@ void GameLogic::onControlStopped(HawkControl control)
             if (control == Menu2) {
                 onResume();
             }
-        } else {
+        } else if (!m_player->stopControl(control)) {
             switch (control) {
-            case MoveLeft:
-                m_player->setHorizontalMovement(DynamicHawkBody::Stop);
-                break;
-            case MoveRight:
-                m_player->setHorizontalMovement(DynamicHawkBody::Stop);
-                break;
-            case ActionA:
-                break;
-            case ActionB:
-            case ActionX:
-            case ActionY:
-                break;
             case Menu2:
                 onPause();
                 break;
+            default:
+                break;
             }
         }
     }
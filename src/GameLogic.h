@@ -22,11 +22,26 @@
 #ifndef GAMELOGIC_H_
 #define GAMELOGIC_H_
 
+#include "AudioThread.h"
+#include "BlockSpawner.h"
+#include "ClipCache.h"
+#include "ContactFilter.h"
+#include "ContactListener.h"
+#include "DebugDraw.h"
 #include "HawkBody.h"
+#include "Level.h"
+#include "ParticleSystem.h"
+#include "PhysicsStats.h"
 #include "Platform.h"
 #include "Sound.h"
 #include "bbutil.h"
 #include "Sprite.h"
+#include "TerrainDestruction.h"
+#include "TerrainIndex.h"
+#include "VoicePool.h"
+#include "WorldChecksum.h"
+#include "WorldSettings.h"
+#include "WorldSnapshot.h"
 
 #include <list>
 #include <math.h>
@@ -34,28 +49,16 @@
 
 #include <GLES/gl.h>
 
-class ContactListener : public b2ContactListener {
-public:
-    ContactListener(const Sound& sound) : m_sound(sound){};
-    virtual ~ContactListener(){};
-
-    virtual void BeginContact(b2Contact* contact) {
-        m_sound.play();
-    }
-    virtual void EndContact(b2Contact* contact) {};
-    virtual void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) {};
-    virtual void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse) {};
-private:
-    const Sound& m_sound;
-};
-
-
 class GameLogic : public HawkInputHandler {
 public:
     GameLogic(Platform& platform);
     virtual ~GameLogic(){};
     void run();
 
+    // Counters from the last step. Only kept up to date while the physics overlay
+    // is on or HAWK_PHYSICS_STATS_LOG is set.
+    const PhysicsStepStats& physicsStats() const { return m_physicsStats.last(); }
+
 private:
     Platform& m_platform;
     bool m_shutdown;
@@ -77,6 +80,7 @@ private:
     Sprite m_smallBlockResting;
     Sprite m_largeBlockBelligerent;
     Sprite m_largeBlockResting;
+    Sprite m_debris;
     Sprite m_buttonPressed;
     Sprite m_buttonRegular;
 
@@ -115,15 +119,39 @@ private:
     std::vector<Score> m_leaderboard;
 
     //Box2D things
-    float m_timeStep;
-    int m_velocityIterations, m_positionIterations;
+    WorldSettings m_worldSettings;
     b2World m_world;
+    Level m_level;
 
     std::list<HawkBody*> m_terrain;
-    std::list<DynamicHawkBody*> m_actors;
+    TerrainIndex m_terrainIndex;
+    HawkBody* m_triggers;
 
     DynamicHawkBody* m_player;
 
+    // Last checkpoint the player touched this game, or 0.
+    const TriggerZone* m_checkpoint;
+
+    // Falling blocks, recycled from fixed pools rather than created per spawn.
+    BlockSpawner m_spawner;
+
+    // Platforms broken by falling blocks, and the debris thrown out of them.
+    TerrainDestruction m_destruction;
+
+    // Sand thrown out of broken platforms. Collides with terrain only.
+    ParticleSystem m_sand;
+
+    // State of the world when play starts, restored by reset().
+    WorldSnapshot m_initialState;
+
+    // Per-step determinism hashes, only computed when HAWK_CHECKSUM_LOG is set.
+    bool m_checksumEnabled;
+    WorldChecksum m_checksum;
+
+    // Body, contact and island counts per step, for the overlay and HAWK_PHYSICS_STATS_LOG.
+    bool m_physicsStatsLogEnabled;
+    PhysicsStats m_physicsStats;
+
     virtual void onLeftPress(float x, float y);
     virtual void onLeftRelease(float x, float y);
     virtual void onExit();
@@ -139,18 +167,33 @@ private:
     void endGamePlay(bool win);
     void reset();
     void update();
+    bool handleTriggers();
+    void breakTerrain(int contactCount);
+    void rebuildTerrainQueries();
     void renderFetchUser();
     void renderGame();
     void renderLeadBoard();
     void enable2D();
     void addNextShape(float x, float y);
 
+    // Shared by the effects below, so they can overlap. Must outlive them.
+    VoicePool m_voices;
+    ClipCache m_clips;
     Sound m_backgroundMusic;
     Sound m_click1;
     Sound m_click2;
     Sound m_clickReverb;
     Sound m_blockFall;
+
+    // Makes every OpenAL call once the sounds are loaded. Stopped when run()
+    // returns, and declared after the sounds so it is stopped before they unload.
+    AudioThread m_audio;
     ContactListener m_contactListener;
+    ContactFilter m_contactFilter;
+
+    // Physics overlay, toggled with ActionY.
+    bool m_debugDrawEnabled;
+    DebugDraw m_debugDraw;
 };
 
 #endif /* GAMELOGIC_H_ */
@@ -31,10 +31,36 @@ void HawkBody::destroyBody()
 void HawkBody::createSprite(const char* path)
 {
     m_sprite.load(path);
+    m_currentSprite = &m_sprite;
+    m_shape = SpriteShape::forSprite(path);
+    m_currentShape = m_shape;
 }
 
 void HawkBody::createFixtureFromSprite()
 {
+    if (m_currentShape && m_currentShape->width() > 0 && m_currentShape->height() > 0) {
+        b2FixtureDef def;
+        def.density = 5.0f;
+        def.friction = 0.7f;
+        def.filter = m_filter;
+
+        // The shape was traced at the image's size; the sprite may be drawn at another.
+        HawkVector scale(width() / m_currentShape->width(), height() / m_currentShape->height());
+        for (int i = 0; i < m_currentShape->polygonCount(); ++i) {
+            int count;
+            const HawkPoint* polygon = m_currentShape->polygon(i, count);
+            b2Vec2 vertices[b2_maxPolygonVertices];
+            for (int v = 0; v < count; ++v)
+                vertices[v] = Hawk::toMeters(HawkPoint(polygon[v].x * scale.x, polygon[v].y * scale.y));
+
+            b2PolygonShape shape;
+            shape.Set(vertices, count);
+            def.shape = &shape;
+            m_body->CreateFixture(&def);
+        }
+        return;
+    }
+
     // Shave off an extra couple of pixels to make the objects appear to contact a little
     // more fully. Otherwise you can clearly see blank pixels between them.
     HawkVector fixtureSize(Hawk::pix2M(width() - 2.f), Hawk::pix2M(height() - 2.f));
@@ -48,10 +74,35 @@ void HawkBody::createFixtureFromSprite()
     def.shape = &dynamicBox;
     def.density = 5.0f;
     def.friction = 0.7f;
+    def.filter = m_filter;
 
     m_body->CreateFixture(&def);
 }
 
+b2Fixture* HawkBody::createSensor(float width, float height, const HawkPoint& offset, void* userData)
+{
+    b2PolygonShape box;
+    box.SetAsBox(Hawk::pix2M(width) / 2, Hawk::pix2M(height) / 2, Hawk::toMeters(offset), 0);
+
+    b2FixtureDef def;
+    def.shape = &box;
+    def.isSensor = true;
+    def.userData = userData;
+    def.filter = m_filter;
+
+    return m_body->CreateFixture(&def);
+}
+
+void HawkBody::setFilter(const b2Filter& filter)
+{
+    m_filter = filter;
+    if (!m_body)
+        return;
+
+    for (b2Fixture* fixture = m_body->GetFixtureList(); fixture; fixture = fixture->GetNext())
+        fixture->SetFilterData(filter);
+}
+
 void DynamicHawkBody::createBody(const HawkPoint& point)
 {
     HawkBody::createBody(point);
@@ -104,4 +155,33 @@ void DynamicHawkBody::applyImpulses()
     }
 }
 
+bool DynamicHawkBody::startControl(HawkControl control)
+{
+    switch (control) {
+    case MoveLeft:
+        setHorizontalMovement(NegativeCruise);
+        return true;
+    case MoveRight:
+        setHorizontalMovement(PositiveCruise);
+        return true;
+    case ActionA:
+        setVerticalMovement(PositiveBurst);
+        return true;
+    default:
+        return false;
+    }
+}
 
+bool DynamicHawkBody::stopControl(HawkControl control)
+{
+    switch (control) {
+    case MoveLeft:
+    case MoveRight:
+        setHorizontalMovement(Stop);
+        return true;
+    case ActionA:
+        return true;
+    default:
+        return false;
+    }
+}
@@ -8,12 +8,42 @@
 #ifndef HAWKBODY_H_
 #define HAWKBODY_H_
 
+#include "HawkControl.h"
 #include "HawkEngine.h"
 
 #include "Sprite.h"
+#include "SpriteShape.h"
+
+class DestructibleHawkBody;
+class DynamicHawkBody;
+
+// Collision categories for HawkBodyDef::categoryBits and maskBits.
+enum HawkCategory {
+    TerrainCategory = 0x0001,
+    PlayerCategory = 0x0002,
+    ActorCategory = 0x0004,
+    BlockCategory = 0x0008,
+    DebrisCategory = 0x0010,
+    SensorCategory = 0x0020,
+    AllCategories = 0xFFFF,
+};
 
 struct HawkBodyDef {
+    HawkBodyDef()
+        : world(0)
+        , categoryBits(TerrainCategory)
+        , maskBits(AllCategories)
+        , groupIndex(0)
+    { }
+
     b2World* world;
+
+    // Applied to every fixture of the body. Two fixtures collide when each one's
+    // category is in the other's mask, unless they share a non-zero group, in which
+    // case a positive group always collides and a negative group never does.
+    uint16 categoryBits;
+    uint16 maskBits;
+    int16 groupIndex;
 };
 
 class HawkBody {
@@ -28,8 +58,14 @@ public:
     HawkBody(const HawkBodyDef& def)
         : m_world(def.world)
         , m_body(0)
+        , m_currentSprite(&m_sprite)
+        , m_shape(0)
+        , m_currentShape(0)
     {
         ASSERT(m_world);
+        m_filter.categoryBits = def.categoryBits;
+        m_filter.maskBits = def.maskBits;
+        m_filter.groupIndex = def.groupIndex;
     }
     virtual ~HawkBody() { }
 
@@ -38,16 +74,37 @@ public:
 
     void createSprite(const char* path);
 
-    Sprite* sprite() { return &m_sprite; }
+    // Draw with a sprite owned elsewhere, so many bodies can share one texture.
+    // shape is the one traced for that sprite, if any, for createFixtureFromSprite.
+    void useSprite(Sprite* sprite, const SpriteShape* shape = 0)
+    {
+        m_currentSprite = sprite ? sprite : &m_sprite;
+        m_currentShape = sprite ? shape : m_shape;
+    }
+
+    Sprite* sprite() { return m_currentSprite; }
 
-    void draw() { m_sprite.draw(); }
+    virtual void draw() { m_currentSprite->draw(); }
     b2Body* body() { return m_body; }
 
-    float width() const { return m_sprite.Width(); }
-    float height() const { return m_sprite.Height(); }
+    float width() const { return m_currentSprite->Width(); }
+    float height() const { return m_currentSprite->Height(); }
 
+    // Uses the polygons traced for the sprite when a .shape file sits next to it,
+    // and a box slightly smaller than the sprite otherwise.
     void createFixtureFromSprite();
 
+    // Adds a width x height pixel sensor box centred offset pixels from the body.
+    // Sensors report overlaps through the contact listener but never push anything.
+    b2Fixture* createSensor(float width, float height, const HawkPoint& offset, void* userData);
+
+    virtual DynamicHawkBody* toDynamic() { return 0; }
+    virtual DestructibleHawkBody* toDestructible() { return 0; }
+
+    // Replaces the collision filter on this body's current and future fixtures.
+    void setFilter(const b2Filter&);
+    const b2Filter& filter() const { return m_filter; }
+
 protected:
     virtual b2BodyType bodyType() const { return b2_staticBody; }
 
@@ -55,6 +112,10 @@ protected:
     b2World* m_world;
     b2Body* m_body;
     Sprite m_sprite;
+    Sprite* m_currentSprite;
+    const SpriteShape* m_shape;
+    const SpriteShape* m_currentShape;
+    b2Filter m_filter;
 };
 
 struct DynamicHawkBodyDef : HawkBodyDef {
@@ -91,6 +152,18 @@ public:
 
     void setHorizontalMovement(Movement movement) { m_horizontal = movement; }
     void setVerticalMovement(Movement movement) { m_vertical = movement; }
+    Movement horizontalMovement() const { return m_horizontal; }
+    Movement verticalMovement() const { return m_vertical; }
+
+    virtual DynamicHawkBody* toDynamic() { return this; }
+
+    const HawkVector& speed() const { return m_speed; }
+    const HawkVector& burst() const { return m_burst; }
+
+    // Translate a player control into movement. Returns false when the control
+    // does not drive movement so the caller may handle it (menus and such).
+    bool startControl(HawkControl);
+    bool stopControl(HawkControl);
 
 private:
     virtual b2BodyType bodyType() const { return b2_dynamicBody; }
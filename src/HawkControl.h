@@ -0,0 +1,25 @@
+/*
+ * HawkControl.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef HAWKCONTROL_H_
+#define HAWKCONTROL_H_
+
+// Abstract game controls. Platform translates keyboard, gamepad and touch
+// input into these; headless tools generate them directly.
+enum HawkControl {
+    MoveLeft,
+    MoveRight,
+    MoveUp,
+    MoveDown,
+    ActionA,
+    ActionB,
+    ActionX,
+    ActionY,
+    Menu1,
+    Menu2,
+};
+
+#endif /* HAWKCONTROL_H_ */
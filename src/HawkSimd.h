@@ -0,0 +1,67 @@
+/*
+ * HawkSimd.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef HAWKSIMD_H_
+#define HAWKSIMD_H_
+
+// Minimal 4-wide float vector for the particle kernels. NEON on ARM
+// devices, SSE on the x86 simulator and desktop tools, otherwise a plain struct
+// so the kernels still build (HAWK_SIMD is 0 then).
+//
+// Loads and stores are unaligned; callers pass plain float arrays.
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+#include <arm_neon.h>
+#define HAWK_SIMD 1
+
+typedef float32x4_t HawkFloat4;
+
+inline HawkFloat4 hawkLoad4(const float* p) { return vld1q_f32(p); }
+inline void hawkStore4(float* p, HawkFloat4 v) { vst1q_f32(p, v); }
+inline HawkFloat4 hawkSplat4(float s) { return vdupq_n_f32(s); }
+inline HawkFloat4 hawkAdd4(HawkFloat4 a, HawkFloat4 b) { return vaddq_f32(a, b); }
+inline HawkFloat4 hawkSub4(HawkFloat4 a, HawkFloat4 b) { return vsubq_f32(a, b); }
+inline HawkFloat4 hawkMul4(HawkFloat4 a, HawkFloat4 b) { return vmulq_f32(a, b); }
+inline HawkFloat4 hawkMin4(HawkFloat4 a, HawkFloat4 b) { return vminq_f32(a, b); }
+inline HawkFloat4 hawkMax4(HawkFloat4 a, HawkFloat4 b) { return vmaxq_f32(a, b); }
+
+#elif defined(__SSE__) || defined(_M_IX86_FP) || defined(_M_X64)
+
+#include <xmmintrin.h>
+#define HAWK_SIMD 1
+
+typedef __m128 HawkFloat4;
+
+inline HawkFloat4 hawkLoad4(const float* p) { return _mm_loadu_ps(p); }
+inline void hawkStore4(float* p, HawkFloat4 v) { _mm_storeu_ps(p, v); }
+inline HawkFloat4 hawkSplat4(float s) { return _mm_set1_ps(s); }
+inline HawkFloat4 hawkAdd4(HawkFloat4 a, HawkFloat4 b) { return _mm_add_ps(a, b); }
+inline HawkFloat4 hawkSub4(HawkFloat4 a, HawkFloat4 b) { return _mm_sub_ps(a, b); }
+inline HawkFloat4 hawkMul4(HawkFloat4 a, HawkFloat4 b) { return _mm_mul_ps(a, b); }
+inline HawkFloat4 hawkMin4(HawkFloat4 a, HawkFloat4 b) { return _mm_min_ps(a, b); }
+inline HawkFloat4 hawkMax4(HawkFloat4 a, HawkFloat4 b) { return _mm_max_ps(a, b); }
+
+#else
+
+#define HAWK_SIMD 0
+
+struct HawkFloat4 {
+    float v[4];
+};
+
+inline HawkFloat4 hawkLoad4(const float* p) { HawkFloat4 r = { { p[0], p[1], p[2], p[3] } }; return r; }
+inline void hawkStore4(float* p, HawkFloat4 v) { for (int i = 0; i < 4; ++i) p[i] = v.v[i]; }
+inline HawkFloat4 hawkSplat4(float s) { HawkFloat4 r = { { s, s, s, s } }; return r; }
+inline HawkFloat4 hawkAdd4(HawkFloat4 a, HawkFloat4 b) { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+inline HawkFloat4 hawkSub4(HawkFloat4 a, HawkFloat4 b) { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+inline HawkFloat4 hawkMul4(HawkFloat4 a, HawkFloat4 b) { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+inline HawkFloat4 hawkMin4(HawkFloat4 a, HawkFloat4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline HawkFloat4 hawkMax4(HawkFloat4 a, HawkFloat4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+
+#endif
+
+#endif /* HAWKSIMD_H_ */
@@ -0,0 +1,260 @@
+/*
+ * KinematicHawkBody.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "KinematicHawkBody.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+// Gap kept between the body and whatever it stands on or walks into, in metres.
+static const float Skin = 0.01f;
+
+namespace {
+
+// Collects the fixtures rays can hit, skipping the caster and sensors.
+class FixtureGatherer : public b2QueryCallback {
+public:
+    FixtureGatherer(const b2Body* self, uint16 mask, std::vector<b2Fixture*>& fixtures)
+        : m_self(self)
+        , m_mask(mask)
+        , m_fixtures(fixtures)
+    { }
+
+    virtual bool ReportFixture(b2Fixture* fixture)
+    {
+        if (fixture->GetBody() == m_self || fixture->IsSensor() || !(fixture->GetFilterData().categoryBits & m_mask))
+            return true;
+
+        // Chains report once per edge.
+        if (fixture->GetShape()->GetChildCount() > 1 && std::find(m_fixtures.begin(), m_fixtures.end(), fixture) != m_fixtures.end())
+            return true;
+
+        m_fixtures.push_back(fixture);
+        return true;
+    }
+
+private:
+    const b2Body* m_self;
+    uint16 m_mask;
+    std::vector<b2Fixture*>& m_fixtures;
+};
+
+}
+
+KinematicHawkBody::KinematicHawkBody(const KinematicHawkBodyDef& def)
+    : HawkBody(def)
+    , m_speed(def.speed)
+    , m_acceleration(def.acceleration)
+    , m_jumpSpeed(def.jumpSpeed)
+    , m_minGroundNormalY(cosf(def.maxSlope))
+    , m_stepHeight(def.stepHeight)
+    , m_direction(0)
+    , m_jumpRequested(false)
+    , m_onGround(false)
+    , m_groundNormal(0, 1)
+    , m_velocity(0, 0)
+{
+}
+
+bool KinematicHawkBody::startControl(HawkControl control)
+{
+    switch (control) {
+    case MoveLeft:
+        m_direction = -1;
+        return true;
+    case MoveRight:
+        m_direction = 1;
+        return true;
+    case ActionA:
+        m_jumpRequested = true;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool KinematicHawkBody::stopControl(HawkControl control)
+{
+    switch (control) {
+    case MoveLeft:
+    case MoveRight:
+        m_direction = 0;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// One query over everything update() may cast through this step: the body
+// widened by the horizontal move and deepened by the vertical one plus a step
+// up and down for findGround().
+void KinematicHawkBody::gatherFixtures(const HawkVector& position, float dx, float dy)
+{
+    float halfWidth = Hawk::pix2M(width() - 2.f) / 2;
+    float halfHeight = Hawk::pix2M(height() - 2.f) / 2;
+
+    b2AABB box;
+    box.lowerBound.x = position.x - halfWidth - fabsf(dx) - Skin;
+    box.upperBound.x = position.x + halfWidth + fabsf(dx) + Skin;
+    box.lowerBound.y = position.y - halfHeight - std::max(-dy, 0.f) - m_stepHeight - Skin;
+    box.upperBound.y = position.y + std::max(halfHeight, m_stepHeight - halfHeight) + std::max(dy, 0.f) + Skin;
+
+    m_fixtures.clear();
+    FixtureGatherer gatherer(m_body, m_filter.maskBits, m_fixtures);
+    m_world->QueryAABB(&gatherer, box);
+}
+
+// Same result as b2World::RayCast with a closest-hit callback, over the gathered fixtures.
+bool KinematicHawkBody::castRay(const HawkVector& from, const HawkVector& to, Hit& hit) const
+{
+    b2RayCastInput input;
+    input.p1 = from;
+    input.p2 = to;
+    input.maxFraction = 1;
+
+    bool found = false;
+    for (unsigned i = 0; i < m_fixtures.size(); ++i) {
+        b2Fixture* fixture = m_fixtures[i];
+        for (int32 child = 0; child < fixture->GetShape()->GetChildCount(); ++child) {
+            b2RayCastOutput output;
+            if (!fixture->RayCast(&output, input, child))
+                continue;
+            found = true;
+            input.maxFraction = output.fraction;
+            hit.normal = output.normal;
+        }
+    }
+    if (!found)
+        return false;
+
+    hit.fraction = input.maxFraction;
+    hit.point = (1.0f - hit.fraction) * input.p1 + hit.fraction * input.p2;
+    return true;
+}
+
+// Returns how far along dx the body can go before running into a wall. Surfaces
+// shallow enough to stand on are not walls; findGround() lifts the body onto them.
+float KinematicHawkBody::moveHorizontally(const HawkVector& position, float dx) const
+{
+    if (!dx)
+        return 0;
+
+    float halfWidth = Hawk::pix2M(width() - 2.f) / 2;
+    float halfHeight = Hawk::pix2M(height() - 2.f) / 2;
+    float side = dx > 0 ? 1.f : -1.f;
+    float reach = halfWidth + fabsf(dx) + Skin;
+
+    // Anything lower than the step height is climbed, so the lowest ray starts there.
+    float heights[3] = { std::min(m_stepHeight - halfHeight, 0.f), 0, halfHeight - Skin };
+
+    float allowed = fabsf(dx);
+    for (int i = 0; i < 3; ++i) {
+        HawkVector from(position.x, position.y + heights[i]);
+        HawkVector to(from.x + side * reach, from.y);
+        Hit hit;
+        if (!castRay(from, to, hit) || hit.normal.y >= m_minGroundNormalY)
+            continue;
+        allowed = std::min(allowed, std::max(hit.fraction * reach - halfWidth - Skin, 0.f));
+    }
+    return side * allowed;
+}
+
+// Casts down from step height above the feet to below metres under them and keeps
+// the highest hit across the left edge, middle and right edge of the body.
+bool KinematicHawkBody::findGround(const HawkVector& position, float below, Hit& ground) const
+{
+    float halfWidth = Hawk::pix2M(width() - 2.f) / 2;
+    float feet = position.y - Hawk::pix2M(height() - 2.f) / 2;
+    float offsets[3] = { -halfWidth + Skin, 0, halfWidth - Skin };
+
+    bool found = false;
+    for (int i = 0; i < 3; ++i) {
+        HawkVector from(position.x + offsets[i], feet + m_stepHeight);
+        HawkVector to(from.x, feet - below);
+        Hit hit;
+        if (castRay(from, to, hit) && (!found || hit.point.y > ground.point.y)) {
+            ground = hit;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void KinematicHawkBody::update(float dt)
+{
+    if (!m_body || dt <= 0)
+        return;
+
+    const HawkVector position = m_body->GetPosition();
+    const float halfHeight = Hawk::pix2M(height() - 2.f) / 2;
+
+    float target = m_direction * m_speed;
+    float change = m_acceleration * dt;
+    m_velocity.x += std::max(-change, std::min(target - m_velocity.x, change));
+
+    if (m_jumpRequested && m_onGround) {
+        m_velocity.y = m_jumpSpeed;
+        m_onGround = false;
+    }
+    m_jumpRequested = false;
+    if (!m_onGround)
+        m_velocity.y += m_world->GetGravity().y * dt;
+
+    float dx = m_velocity.x * dt;
+    float dy = m_onGround ? 0 : m_velocity.y * dt;
+    gatherFixtures(position, dx, dy);
+
+    HawkVector next = position;
+    next.x += moveHorizontally(position, dx);
+    if (next.x - position.x != dx)
+        m_velocity.x = 0;
+
+    if (dy > 0) {
+        float halfWidth = Hawk::pix2M(width() - 2.f) / 2;
+        float top = next.y + halfHeight;
+        for (int side = -1; side <= 1; side += 2) {
+            HawkVector from(next.x + side * (halfWidth - Skin), top);
+            Hit hit;
+            if (castRay(from, HawkVector(from.x, top + dy + Skin), hit)) {
+                dy = std::max(hit.fraction * (dy + Skin) - Skin, 0.f);
+                m_velocity.y = 0;
+            }
+        }
+        next.y += dy;
+        m_onGround = false;
+    } else {
+        // While grounded, reach down a step as well so the body follows slopes and
+        // small drops instead of launching off them.
+        float below = -dy + (m_onGround ? m_stepHeight : 0) + Skin;
+        Hit ground;
+        bool found = findGround(next, below, ground);
+
+        float feet = next.y - halfHeight;
+        if (found && ground.normal.y < m_minGroundNormalY && ground.point.y > feet) {
+            // Too steep to walk up.
+            next.x = position.x;
+            m_velocity.x = 0;
+            found = findGround(next, below, ground);
+        }
+
+        if (found && ground.normal.y >= m_minGroundNormalY) {
+            next.y = ground.point.y + halfHeight + Skin;
+            m_velocity.y = 0;
+            m_groundNormal = ground.normal;
+            m_onGround = true;
+        } else {
+            next.y = found ? std::max(next.y + dy, ground.point.y + halfHeight + Skin) : next.y + dy;
+            m_groundNormal = HawkVector(0, 1);
+            m_onGround = false;
+        }
+    }
+
+    // Let Step carry the body there, so dynamic bodies in the way are pushed aside.
+    HawkVector velocity = next - position;
+    velocity *= 1 / dt;
+    m_body->SetLinearVelocity(velocity);
+}
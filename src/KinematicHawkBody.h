@@ -0,0 +1,98 @@
+/*
+ * KinematicHawkBody.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef KINEMATICHAWKBODY_H_
+#define KINEMATICHAWKBODY_H_
+
+#include "HawkBody.h"
+
+#include <vector>
+
+struct KinematicHawkBodyDef : HawkBodyDef {
+    KinematicHawkBodyDef()
+        : speed(4)
+        , acceleration(40)
+        , jumpSpeed(8)
+        , maxSlope(b2_pi / 4)
+        , stepHeight(0.2f)
+    { }
+
+    // Top walking speed and how fast it is reached or lost, in m/s and m/s².
+    float speed;
+    float acceleration;
+
+    // Upward speed at the start of a jump in m/s.
+    float jumpSpeed;
+
+    // Steepest surface, in radians from flat, that still counts as ground.
+    float maxSlope;
+
+    // Ledges up to this many metres high are walked over rather than blocking.
+    float stepHeight;
+};
+
+class KinematicHawkBody : public HawkBody {
+public:
+    /**
+     * A character moved by casting rays against the world instead of by the solver.
+     *
+     * The body is kinematic, so it has no mass, ignores gravity and never takes part
+     * in the contact solver; update() works out where it may go with a handful of
+     * raycasts and sets the velocity that gets it there over the next Step. Dynamic
+     * bodies are still pushed out of its way.
+     *
+     * The rays are not cast through the world: update() collects the fixtures
+     * around the body's path with one AABB query and casts against those alone.
+     *
+     * Movement is in m/s and integrated against the time step, so the feel does not
+     * change with the frame rate.
+     */
+    KinematicHawkBody(const KinematicHawkBodyDef& def);
+    virtual ~KinematicHawkBody() { }
+
+    // Same controls as DynamicHawkBody: left/right walk, ActionA jumps.
+    bool startControl(HawkControl);
+    bool stopControl(HawkControl);
+
+    // Call before b2World::Step with the same dt.
+    void update(float dt);
+
+    bool onGround() const { return m_onGround; }
+    const HawkVector& groundNormal() const { return m_groundNormal; }
+    const HawkVector& velocity() const { return m_velocity; }
+
+protected:
+    virtual b2BodyType bodyType() const { return b2_kinematicBody; }
+
+private:
+    struct Hit {
+        float fraction;
+        HawkVector point;
+        HawkVector normal;
+    };
+
+    void gatherFixtures(const HawkVector& position, float dx, float dy);
+    bool castRay(const HawkVector& from, const HawkVector& to, Hit&) const;
+    float moveHorizontally(const HawkVector& position, float dx) const;
+    bool findGround(const HawkVector& position, float below, Hit&) const;
+
+    const float m_speed;
+    const float m_acceleration;
+    const float m_jumpSpeed;
+    const float m_minGroundNormalY;
+    const float m_stepHeight;
+
+    int m_direction;
+    bool m_jumpRequested;
+    bool m_onGround;
+    HawkVector m_groundNormal;
+    HawkVector m_velocity;
+
+    // Fixtures the rays of the current update() can hit, reused between updates.
+    std::vector<b2Fixture*> m_fixtures;
+};
+
+#endif /* KINEMATICHAWKBODY_H_ */
@@ -0,0 +1,116 @@
+/*
+ * Level.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "Level.h"
+
+static const int PlatformCount = 4;
+static const float PlatformStepHeight = 200.f;
+
+Level::Level()
+    : m_sceneWidth(0)
+    , m_sceneHeight(0)
+    , m_spawn(0, 0)
+{
+    for (int i = 0; i < TriggerZone::KindCount; ++i) {
+        m_areas[i].lowerBound.SetZero();
+        m_areas[i].upperBound.SetZero();
+        m_zones[i].kind = static_cast<TriggerZone::Kind>(i);
+        m_zones[i].respawn.SetZero();
+    }
+}
+
+void Level::load(const std::string& assetRoot, float sceneWidth, float sceneHeight)
+{
+    m_assetRoot = assetRoot;
+    m_sceneWidth = sceneWidth;
+    m_sceneHeight = sceneHeight;
+    m_spawn = HawkPoint(sceneWidth / 2, sceneHeight / 2);
+}
+
+void Level::createTerrain(b2World* world, std::list<HawkBody*>& terrain)
+{
+    DestructibleHawkBodyDef def;
+    def.world = world;
+    def.categoryBits = TerrainCategory;
+
+    for (int i = 0; i < PlatformCount; ++i) {
+        bool goal = i == PlatformCount - 1;
+        HawkBody* platform = goal ? new HawkBody(def) : new DestructibleHawkBody(def);
+        platform->createSprite(asset("ground.png").c_str());
+
+        HawkPoint center((i * (m_sceneWidth / PlatformCount)) + (platform->width() / 2), ((i % 2) * PlatformStepHeight) + platform->height());
+        platform->createBody(center);
+        if (DestructibleHawkBody* destructible = platform->toDestructible())
+            destructible->createFixturesFromGrid();
+        else
+            platform->createFixtureFromSprite();
+        terrain.push_back(platform);
+
+        // The checkpoint is standing on the middle platform and the goal on the last one.
+        b2AABB above;
+        above.lowerBound = HawkPoint(center.x - platform->width() / 2, center.y + platform->height() / 2);
+        above.upperBound = HawkPoint(center.x + platform->width() / 2, center.y + PlatformStepHeight);
+        if (i == PlatformCount / 2) {
+            m_areas[TriggerZone::Checkpoint] = above;
+            m_zones[TriggerZone::Checkpoint].respawn = above.GetCenter();
+        }
+        if (goal)
+            m_areas[TriggerZone::Goal] = above;
+    }
+}
+
+HawkBody* Level::createTriggers(b2World* world, const HawkBody* player)
+{
+    // The player is lost once its centre drops a full player height below the
+    // screen. The sensor fires on its lowest point, half a height further down.
+    // Wide enough to catch anything thrown off either side of the screen.
+    float killTop = -1.5f * player->height();
+    m_areas[TriggerZone::Kill].lowerBound = HawkPoint(-m_sceneWidth, killTop - m_sceneHeight);
+    m_areas[TriggerZone::Kill].upperBound = HawkPoint(2 * m_sceneWidth, killTop);
+
+    HawkBodyDef def;
+    def.world = world;
+    def.categoryBits = SensorCategory;
+
+    HawkBody* triggers = new HawkBody(def);
+    triggers->createBody(HawkPoint(0, 0));
+
+    for (int i = 0; i < TriggerZone::KindCount; ++i) {
+        HawkVector size = m_areas[i].upperBound - m_areas[i].lowerBound;
+        if (size.x <= 0 || size.y <= 0)
+            continue;
+        triggers->createSensor(size.x, size.y, m_areas[i].GetCenter(), &m_zones[i]);
+    }
+    return triggers;
+}
+
+const TriggerZone* Level::zone(const b2Fixture* sensor) const
+{
+    const TriggerZone* zone = static_cast<const TriggerZone*>(sensor->GetUserData());
+    if (zone < m_zones || zone >= m_zones + TriggerZone::KindCount)
+        return 0;
+    return zone;
+}
+
+DynamicHawkBody* Level::createPlayer(const DynamicHawkBodyDef& def) const
+{
+    DynamicHawkBody* player = new DynamicHawkBody(def);
+    player->createSprite(asset("resting.png").c_str());
+    player->createBody(m_spawn);
+    player->createFixtureFromSprite();
+    return player;
+}
+
+DynamicHawkBodyDef Level::playerDef(b2World* world) const
+{
+    DynamicHawkBodyDef def;
+    def.world = world;
+    def.speed = HawkVector(4, 4);
+    def.burst = HawkVector(8, 8);
+    def.fixedRotation = true;
+    def.categoryBits = PlayerCategory;
+    return def;
+}
@@ -0,0 +1,73 @@
+/*
+ * Level.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef LEVEL_H_
+#define LEVEL_H_
+
+#include "DestructibleHawkBody.h"
+
+#include <list>
+#include <string>
+
+// An area of the level that reacts when the player overlaps it.
+struct TriggerZone {
+    enum Kind { Goal, Kill, Checkpoint, KindCount };
+
+    Kind kind;
+
+    // Where the player comes back after hitting a kill zone, for checkpoints. Pixels.
+    HawkPoint respawn;
+};
+
+class Level {
+public:
+    /**
+     * Describes the terrain, player and win/lose areas of a level.
+     *
+     * A Level only needs a b2World and the asset directory, so the same layout is
+     * shared by GameLogic and the headless tools.
+     *
+     * Positions passed in and out of a Level are in pixels, like the sprites.
+     */
+    Level();
+
+    void load(const std::string& assetRoot, float sceneWidth, float sceneHeight);
+
+    // Creates the static platforms. All but the goal platform are destructible.
+    // Ownership of the bodies passes to the caller.
+    void createTerrain(b2World*, std::list<HawkBody*>& terrain);
+
+    // Creates a static body holding one sensor per TriggerZone. Call after
+    // createTerrain and createPlayer; the kill zone is placed by the player's
+    // height. Ownership of the body passes to the caller.
+    HawkBody* createTriggers(b2World*, const HawkBody* player);
+
+    // The zone a sensor fixture from createTriggers belongs to, or 0 for other sensors.
+    const TriggerZone* zone(const b2Fixture* sensor) const;
+
+    // Creates the player at the spawn point. Ownership passes to the caller.
+    DynamicHawkBody* createPlayer(const DynamicHawkBodyDef&) const;
+
+    // Movement parameters the game uses for the player in this level.
+    DynamicHawkBodyDef playerDef(b2World*) const;
+
+    const HawkPoint& spawnPoint() const { return m_spawn; }
+
+private:
+    std::string asset(const char* name) const { return m_assetRoot + name; }
+
+    std::string m_assetRoot;
+    float m_sceneWidth;
+    float m_sceneHeight;
+
+    HawkPoint m_spawn;
+
+    // Zone areas in pixels, indexed by TriggerZone::Kind.
+    b2AABB m_areas[TriggerZone::KindCount];
+    TriggerZone m_zones[TriggerZone::KindCount];
+};
+
+#endif /* LEVEL_H_ */
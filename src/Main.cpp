@@ -38,8 +38,11 @@ int main(int argc, char ** argv) {
         return EXIT_FAILURE;
     }
 
-    GameLogic game(platform);
-    game.run();
+    // The game owns OpenAL sources and buffers, so it goes before the context does.
+    {
+        GameLogic game(platform);
+        game.run();
+    }
 
     alutExit();
 
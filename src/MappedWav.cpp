@@ -0,0 +1,143 @@
+/*
+ * MappedWav.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "MappedWav.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static unsigned readLE16(const unsigned char* p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned readLE32(const unsigned char* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<unsigned>(p[3]) << 24);
+}
+
+MappedWav::MappedWav()
+    : m_mapping(0)
+    , m_length(0)
+    , m_format(0)
+    , m_frequency(0)
+    , m_data(0)
+    , m_size(0)
+{
+}
+
+MappedWav::~MappedWav()
+{
+    close();
+}
+
+bool MappedWav::open(const char* fileName)
+{
+    close();
+
+    int fd = ::open(fileName, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot open %s\n", fileName);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) || info.st_size < 12) {
+        fprintf(stderr, "%s is not a WAV file\n", fileName);
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive; the descriptor is not needed any more.
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "Cannot map %s\n", fileName);
+        return false;
+    }
+    m_mapping = mapping;
+    m_length = info.st_size;
+
+    const unsigned char* file = static_cast<const unsigned char*>(m_mapping);
+    if (memcmp(file, "RIFF", 4) || memcmp(file + 8, "WAVE", 4)) {
+        fprintf(stderr, "%s is not a WAV file\n", fileName);
+        close();
+        return false;
+    }
+
+    // The chunks are read in place, so every size is checked against the file end.
+    int frameSize = 0;
+    size_t offset = 12;
+    while (offset + 8 <= m_length) {
+        const unsigned char* chunk = file + offset;
+        size_t size = readLE32(chunk + 4);
+        size_t left = m_length - offset - 8;
+
+        if (!memcmp(chunk, "fmt ", 4)) {
+            if (size < 16 || size > left)
+                break;
+            unsigned encoding = readLE16(chunk + 8);
+            unsigned channels = readLE16(chunk + 10);
+            unsigned bits = readLE16(chunk + 22);
+            if (encoding != 1 || channels < 1 || channels > 2 || (bits != 8 && bits != 16)) {
+                fprintf(stderr, "%s: only 8 and 16 bit mono or stereo PCM is supported\n", fileName);
+                close();
+                return false;
+            }
+
+            m_frequency = readLE32(chunk + 12);
+            frameSize = channels * bits / 8;
+            if (channels == 1)
+                m_format = bits == 8 ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
+            else
+                m_format = bits == 8 ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
+        } else if (!memcmp(chunk, "data", 4) && frameSize) {
+            // A data chunk cut short by a truncated file still plays up to the cut.
+            if (size > left)
+                size = left;
+            m_data = chunk + 8;
+            m_size = size - size % frameSize;
+            return true;
+        }
+
+        // Chunks are padded to an even size.
+        if (size > left)
+            break;
+        offset += 8 + size + (size & 1);
+    }
+
+    fprintf(stderr, "%s has no PCM data\n", fileName);
+    close();
+    return false;
+}
+
+void MappedWav::close()
+{
+    if (m_mapping)
+        munmap(m_mapping, m_length);
+    m_mapping = 0;
+    m_length = 0;
+    m_data = 0;
+    m_size = 0;
+}
+
+void MappedWav::prefault() const
+{
+    if (!m_data || !m_size)
+        return;
+
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0)
+        page = 4096;
+    volatile unsigned char sink = 0;
+    for (ALsizei i = 0; i < m_size; i += page)
+        sink += m_data[i];
+    sink += m_data[m_size - 1];
+}
@@ -0,0 +1,52 @@
+/*
+ * MappedWav.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef MAPPEDWAV_H_
+#define MAPPEDWAV_H_
+
+#include <AL/al.h>
+
+#include <stddef.h>
+
+class MappedWav {
+public:
+    /**
+     * A RIFF/WAV file mapped into memory, with its PCM data located in place.
+     *
+     * open() maps the file read-only and checks every chunk header against the
+     * file size before trusting it. data() points into the mapping, so the
+     * samples can go straight to alBufferData() without a copy of the file
+     * on the heap. The mapping lives until close() or destruction.
+     */
+    MappedWav();
+    ~MappedWav();
+
+    bool open(const char* fileName);
+    void close();
+    bool isOpen() const { return m_mapping != 0; }
+
+    // Reads one byte of every page of the PCM data, so a later copy does not
+    // wait on the disk. Lets a loader thread take the I/O off the caller.
+    void prefault() const;
+
+    ALenum format() const { return m_format; }
+    ALsizei frequency() const { return m_frequency; }
+    const void* data() const { return m_data; }
+    ALsizei size() const { return m_size; }
+
+private:
+    MappedWav(const MappedWav&);
+    MappedWav& operator=(const MappedWav&);
+
+    void* m_mapping;
+    size_t m_length;
+    ALenum m_format;
+    ALsizei m_frequency;
+    const unsigned char* m_data;
+    ALsizei m_size;
+};
+
+#endif /* MAPPEDWAV_H_ */
@@ -0,0 +1,284 @@
+/*
+ * NavGraph.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "NavGraph.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+// Tops closer than this in height and gap are walked across as one surface.
+static const float MergeTolerance = 0.02f;
+
+// Room an actor needs beside an edge to jump past it or drop off it, in metres.
+static const float EdgeClearance = 0.5f;
+
+// Falls deeper than this are not considered routes.
+static const float MaxDrop = 20.f;
+
+static bool lowerThenLeft(const NavSurface& a, const NavSurface& b)
+{
+    return a.y < b.y || (a.y == b.y && a.left < b.left);
+}
+
+namespace {
+
+struct ByLeft {
+    ByLeft(const std::vector<NavSurface>& surfaces) : surfaces(surfaces) { }
+    bool operator()(int a, int b) const { return surfaces[a].left < surfaces[b].left; }
+    bool operator()(int a, float left) const { return surfaces[a].left < left; }
+    const std::vector<NavSurface>& surfaces;
+};
+
+}
+
+NavGraph::NavGraph()
+    : m_speed(1)
+    , m_searchStamp(0)
+{
+}
+
+void NavGraph::clear()
+{
+    m_surfaces.clear();
+    m_links.clear();
+    m_firstLink.clear();
+    m_outgoing.clear();
+    m_cache.clear();
+}
+
+void NavGraph::build(b2World* world, const DynamicHawkBodyDef& mover)
+{
+    clear();
+
+    m_speed = mover.speed.x > 0 ? mover.speed.x : 1;
+    collectSurfaces(world);
+    linkSurfaces(m_speed, mover.burst.y, fabsf(world->GetGravity().y));
+
+    m_costs.resize(m_surfaces.size());
+    m_cameBy.resize(m_surfaces.size());
+    m_visited.assign(m_surfaces.size(), 0);
+    m_searchStamp = 0;
+}
+
+void NavGraph::collectSurfaces(b2World* world)
+{
+    std::vector<NavSurface> tops;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        if (body->GetType() != b2_staticBody || !body->GetUserData())
+            continue;
+
+        for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext()) {
+            if (fixture->IsSensor())
+                continue;
+            const b2AABB& box = fixture->GetAABB(0);
+            NavSurface top = { box.lowerBound.x, box.upperBound.x, box.upperBound.y };
+            tops.push_back(top);
+        }
+    }
+
+    // Rows of tiles become one surface, so walking along them needs no links.
+    std::sort(tops.begin(), tops.end(), lowerThenLeft);
+    for (unsigned i = 0; i < tops.size(); ++i) {
+        if (!m_surfaces.empty()) {
+            NavSurface& last = m_surfaces.back();
+            if (fabsf(tops[i].y - last.y) <= MergeTolerance && tops[i].left <= last.right + MergeTolerance) {
+                last.right = std::max(last.right, tops[i].right);
+                continue;
+            }
+        }
+        m_surfaces.push_back(tops[i]);
+    }
+}
+
+void NavGraph::linkSurfaces(float speed, float jumpSpeed, float gravity)
+{
+    if (m_surfaces.empty() || gravity <= 0)
+        return;
+
+    const float jumpHeight = jumpSpeed > 0 ? jumpSpeed * jumpSpeed / (2 * gravity) : 0;
+    const float longestFlight = (std::max(jumpSpeed, 0.f) + sqrtf(jumpSpeed * jumpSpeed + 2 * gravity * MaxDrop)) / gravity;
+    const float maxReach = speed * longestFlight + 2 * EdgeClearance;
+
+    std::vector<int> order(m_surfaces.size());
+    float widest = 0;
+    for (unsigned i = 0; i < order.size(); ++i) {
+        order[i] = i;
+        widest = std::max(widest, m_surfaces[i].right - m_surfaces[i].left);
+    }
+    ByLeft byLeft(m_surfaces);
+    std::sort(order.begin(), order.end(), byLeft);
+
+    for (unsigned i = 0; i < m_surfaces.size(); ++i) {
+        const NavSurface& a = m_surfaces[i];
+
+        // Only surfaces whose left edge is within reach of a need looking at.
+        std::vector<int>::iterator candidate = std::lower_bound(order.begin(), order.end(), a.left - maxReach - widest, byLeft);
+        for (; candidate != order.end() && m_surfaces[*candidate].left <= a.right + maxReach; ++candidate) {
+            int j = *candidate;
+            const NavSurface& b = m_surfaces[j];
+            float dy = b.y - a.y;
+            if (j == static_cast<int>(i) || dy < -MaxDrop || dy > jumpHeight)
+                continue;
+
+            // Pick where to leave a and land on b. Overlapping surfaces are reached
+            // around an edge, which needs room beside it.
+            float takeOffX, landingX;
+            if (b.left >= a.right) {
+                takeOffX = a.right;
+                landingX = b.left;
+            } else if (b.right <= a.left) {
+                takeOffX = a.left;
+                landingX = b.right;
+            } else if (dy > MergeTolerance && a.left <= b.left - EdgeClearance) {
+                takeOffX = b.left - EdgeClearance;
+                landingX = b.left + std::min(EdgeClearance, (b.right - b.left) / 2);
+            } else if (dy > MergeTolerance && a.right >= b.right + EdgeClearance) {
+                takeOffX = b.right + EdgeClearance;
+                landingX = b.right - std::min(EdgeClearance, (b.right - b.left) / 2);
+            } else if (dy < -MergeTolerance && b.left <= a.left - EdgeClearance) {
+                takeOffX = a.left;
+                landingX = a.left - EdgeClearance;
+            } else if (dy < -MergeTolerance && b.right >= a.right + EdgeClearance) {
+                takeOffX = a.right;
+                landingX = a.right + EdgeClearance;
+            } else {
+                continue;
+            }
+            float distance = fabsf(landingX - takeOffX);
+
+            // Walking off the edge is preferred; jumping buys more air time.
+            if (dy < 0) {
+                float fall = sqrtf(-2 * dy / gravity);
+                if (speed * fall >= distance) {
+                    addLink(NavLink::Fall, i, j, takeOffX, landingX, fall);
+                    continue;
+                }
+            }
+
+            float discriminant = jumpSpeed * jumpSpeed - 2 * gravity * dy;
+            if (jumpSpeed <= 0 || discriminant < 0)
+                continue;
+            float flight = (jumpSpeed + sqrtf(discriminant)) / gravity;
+            if (speed * flight >= distance)
+                addLink(NavLink::Jump, i, j, takeOffX, landingX, flight);
+        }
+    }
+
+    // Group the links by the surface they start from.
+    m_firstLink.assign(m_surfaces.size() + 1, 0);
+    for (unsigned i = 0; i < m_links.size(); ++i)
+        ++m_firstLink[m_links[i].from + 1];
+    for (unsigned i = 0; i < m_surfaces.size(); ++i)
+        m_firstLink[i + 1] += m_firstLink[i];
+
+    std::vector<int> next(m_firstLink.begin(), m_firstLink.end() - 1);
+    m_outgoing.resize(m_links.size());
+    for (unsigned i = 0; i < m_links.size(); ++i)
+        m_outgoing[next[m_links[i].from]++] = i;
+}
+
+void NavGraph::addLink(NavLink::Kind kind, int from, int to, float takeOffX, float landingX, float time)
+{
+    // Cost includes walking from the middle of the surface to the take off point,
+    // so A* prefers nearby edges as well as short flights.
+    const NavSurface& surface = m_surfaces[from];
+    float walk = fabsf(takeOffX - (surface.left + surface.right) / 2) / m_speed;
+
+    NavLink link = { kind, from, to, takeOffX, landingX, time + walk };
+    m_links.push_back(link);
+}
+
+int NavGraph::surfaceAt(const HawkVector& position) const
+{
+    int best = -1;
+    for (unsigned i = 0; i < m_surfaces.size(); ++i) {
+        const NavSurface& surface = m_surfaces[i];
+        if (position.x < surface.left || position.x > surface.right || surface.y > position.y + MergeTolerance)
+            continue;
+        if (best < 0 || surface.y > m_surfaces[best].y)
+            best = i;
+    }
+    return best;
+}
+
+bool NavGraph::search(int from, int to, std::vector<int>& path)
+{
+    typedef std::pair<float, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > open;
+
+    // Stamps make clearing the per-surface state free between searches.
+    if (++m_searchStamp == 0) {
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_searchStamp = 1;
+    }
+
+    const NavSurface& goal = m_surfaces[to];
+
+    m_visited[from] = m_searchStamp;
+    m_costs[from] = 0;
+    m_cameBy[from] = -1;
+    open.push(Entry(0, from));
+
+    while (!open.empty()) {
+        Entry entry = open.top();
+        open.pop();
+        int current = entry.second;
+
+        if (current == to) {
+            path.clear();
+            for (int link = m_cameBy[to]; link >= 0; link = m_cameBy[m_links[link].from])
+                path.push_back(link);
+            std::reverse(path.begin(), path.end());
+            return true;
+        }
+
+        for (int k = m_firstLink[current]; k < m_firstLink[current + 1]; ++k) {
+            const NavLink& link = m_links[m_outgoing[k]];
+            float cost = m_costs[current] + link.cost;
+            if (m_visited[link.to] == m_searchStamp && cost >= m_costs[link.to])
+                continue;
+
+            m_visited[link.to] = m_searchStamp;
+            m_costs[link.to] = cost;
+            m_cameBy[link.to] = m_outgoing[k];
+
+            // Never overestimates: nothing crosses the horizontal gap faster than cruising.
+            const NavSurface& surface = m_surfaces[link.to];
+            float gap = std::max(0.f, std::max(goal.left - surface.right, surface.left - goal.right));
+            open.push(Entry(cost + gap / m_speed, link.to));
+        }
+    }
+    return false;
+}
+
+const std::vector<int>* NavGraph::findPath(int from, int to)
+{
+    int count = m_surfaces.size();
+    if (from < 0 || to < 0 || from >= count || to >= count)
+        return 0;
+
+    std::pair<int, int> key(from, to);
+    std::map<std::pair<int, int>, CachedPath>::iterator cached = m_cache.find(key);
+    if (cached == m_cache.end()) {
+        if (m_cache.size() >= MaxCachedPaths)
+            m_cache.clear();
+
+        cached = m_cache.insert(std::make_pair(key, CachedPath())).first;
+        cached->second.found = search(from, to, cached->second.links);
+    }
+    return cached->second.found ? &cached->second.links : 0;
+}
+
+const NavLink* NavGraph::nextLink(int from, int to)
+{
+    const std::vector<int>* path = findPath(from, to);
+    if (!path || path->empty())
+        return 0;
+    return &m_links[path->front()];
+}
@@ -0,0 +1,104 @@
+/*
+ * NavGraph.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef NAVGRAPH_H_
+#define NAVGRAPH_H_
+
+#include "HawkBody.h"
+
+#include <map>
+#include <vector>
+
+// The walkable top of one or more touching static fixtures.
+struct NavSurface {
+    float left;
+    float right;
+    float y;
+};
+
+// A way to get from one surface to another without walking.
+struct NavLink {
+    enum Kind { Jump, Fall };
+
+    Kind kind;
+    int from;
+    int to;
+
+    // Where to leave the first surface and roughly where the landing is.
+    float takeOffX;
+    float landingX;
+
+    // Time in the air, in seconds.
+    float cost;
+};
+
+class NavGraph {
+public:
+    /**
+     * Walkable surfaces of the static terrain and the jumps and falls between them.
+     *
+     * build() looks at every fixture of every static body once, at level load, and
+     * works out which surfaces an actor with the given speed and burst can reach
+     * from which. After that, path queries are A* over the graph and never touch
+     * the b2World. Paths are cached per (from, to) pair until the next build.
+     *
+     * All positions are in metres, like b2Body positions.
+     */
+    NavGraph();
+
+    void build(b2World*, const DynamicHawkBodyDef& mover);
+    void clear();
+
+    // The highest surface under position, or -1.
+    int surfaceAt(const HawkVector& position) const;
+
+    /**
+     * The links to follow from surface from to surface to, in order, or 0 when
+     * there is no way there. The vector stays valid until the next findPath() or build().
+     */
+    const std::vector<int>* findPath(int from, int to);
+
+    // First link to take from surface from towards to, or 0 if none (or already there).
+    const NavLink* nextLink(int from, int to);
+
+    int surfaceCount() const { return m_surfaces.size(); }
+    const NavSurface& surface(int index) const { return m_surfaces[index]; }
+    int linkCount() const { return m_links.size(); }
+    const NavLink& link(int index) const { return m_links[index]; }
+
+    int cachedPathCount() const { return m_cache.size(); }
+
+private:
+    enum { MaxCachedPaths = 1024 };
+
+    void collectSurfaces(b2World*);
+    void linkSurfaces(float speed, float jumpSpeed, float gravity);
+    void addLink(NavLink::Kind, int from, int to, float takeOffX, float landingX, float time);
+    bool search(int from, int to, std::vector<int>& path);
+
+    std::vector<NavSurface> m_surfaces;
+    std::vector<NavLink> m_links;
+
+    // Outgoing links of surface i are m_outgoing[m_firstLink[i]] up to m_firstLink[i + 1].
+    std::vector<int> m_firstLink;
+    std::vector<int> m_outgoing;
+
+    float m_speed;
+
+    struct CachedPath {
+        bool found;
+        std::vector<int> links;
+    };
+    std::map<std::pair<int, int>, CachedPath> m_cache;
+
+    // Scratch space for search(), sized to the surface count.
+    std::vector<float> m_costs;
+    std::vector<int> m_cameBy;
+    std::vector<unsigned> m_visited;
+    unsigned m_searchStamp;
+};
+
+#endif /* NAVGRAPH_H_ */
@@ -0,0 +1,551 @@
+/*
+ * ParticleSystem.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "ParticleSystem.h"
+#include "HawkSimd.h"
+
+#include <float.h>
+#include <math.h>
+
+#include <algorithm>
+
+static const unsigned InitialSeed = 0x9e3779b9;
+
+// Fastest a grain may move along either axis, in metres per second. Keeps a
+// grain from passing through a platform in one step.
+static const float MaxSpeed = 8.f;
+
+// How much of an overlap between two grains is resolved per step.
+static const float Stiffness = 0.5f;
+
+// Extra share of a push taken by the upper of two grains stacked straight on top
+// of each other. With even shares a deep pile sinks into itself and never rests.
+static const float StackBias = 0.45f;
+
+// Side of the cells terrain fixtures are cached for, in metres.
+static const float TerrainCellSize = 1.f;
+
+// A grain slower than this, in metres per second, for TimeToSleep seconds falls
+// asleep. A grain hitting a sleeping one faster than WakeSpeed wakes it.
+static const float SleepSpeed = 0.05f;
+static const float TimeToSleep = 0.5f;
+static const float WakeSpeed = 1.f;
+
+namespace {
+
+class FixtureCollector : public b2QueryCallback {
+public:
+    FixtureCollector(std::vector<b2Fixture*>& fixtures)
+        : fixtures(fixtures)
+    { }
+
+    // Grains only collide with solid polygons and circles, which is all levels are built from.
+    virtual bool ReportFixture(b2Fixture* fixture)
+    {
+        b2Shape::Type type = fixture->GetType();
+        if (!fixture->IsSensor() && (type == b2Shape::e_polygon || type == b2Shape::e_circle))
+            fixtures.push_back(fixture);
+        return true;
+    }
+
+    std::vector<b2Fixture*>& fixtures;
+};
+
+}
+
+// Moves point out of fixture, grown by radius. Returns false when they do not overlap.
+// previous is where the point was a step ago.
+static bool pushOut(const b2Fixture* fixture, float radius, const b2Vec2& previous, b2Vec2& point, b2Vec2& normal)
+{
+    const b2Body* body = fixture->GetBody();
+
+    if (fixture->GetType() == b2Shape::e_circle) {
+        const b2CircleShape* circle = static_cast<const b2CircleShape*>(fixture->GetShape());
+        b2Vec2 offset = point - body->GetWorldPoint(circle->m_p);
+        float reach = radius + circle->m_radius;
+        float distance = offset.Length();
+        if (distance >= reach || distance < FLT_EPSILON)
+            return false;
+        normal = (1 / distance) * offset;
+        point += (reach - distance) * normal;
+        return true;
+    }
+
+    // Out through the face the point came in by, or the least penetrating one if it
+    // was already inside. Picking by depth alone lets grains pressed into the floor
+    // slip down the seam between two boxes, where a side face is the shallower one.
+    const b2PolygonShape* polygon = static_cast<const b2PolygonShape*>(fixture->GetShape());
+    b2Vec2 local = body->GetLocalPoint(point);
+    b2Vec2 localPrevious = body->GetLocalPoint(previous);
+    float reach = radius + polygon->m_radius;
+    float separation[b2_maxPolygonVertices];
+    float entry = -FLT_MAX, deepest = -FLT_MAX;
+    int entryFace = 0, deepestFace = 0;
+    for (int32 i = 0; i < polygon->m_count; ++i) {
+        separation[i] = b2Dot(polygon->m_normals[i], local - polygon->m_vertices[i]);
+        if (separation[i] >= reach)
+            return false;
+        if (separation[i] > deepest) {
+            deepest = separation[i];
+            deepestFace = i;
+        }
+        float before = b2Dot(polygon->m_normals[i], localPrevious - polygon->m_vertices[i]);
+        if (before > entry) {
+            entry = before;
+            entryFace = i;
+        }
+    }
+
+    int face = entry >= 0 ? entryFace : deepestFace;
+    normal = b2Mul(body->GetTransform().q, polygon->m_normals[face]);
+    point += (reach - separation[face]) * normal;
+    return true;
+}
+
+static unsigned hashCell(int x, int y)
+{
+    return static_cast<unsigned>(x) * 73856093u ^ static_cast<unsigned>(y) * 19349663u;
+}
+
+ParticleSystem::ParticleSystem()
+    : m_capacity(0)
+    , m_count(0)
+    , m_awake(0)
+    , m_radius(0.02f)
+    , m_lifetime(4.f)
+    , m_friction(0.3f)
+    , m_killY(-FLT_MAX)
+    , m_seed(InitialSeed)
+    , m_bucketMask(0)
+    , m_sleepingChanged(false)
+{
+    setColor(194, 164, 112, 255);
+}
+
+void ParticleSystem::create(int capacity, float radius)
+{
+    m_capacity = capacity > 0 ? capacity : 0;
+    m_count = 0;
+    m_awake = 0;
+    m_radius = Hawk::pix2M(radius > 0 ? radius : 1);
+
+    m_x.resize(m_capacity);
+    m_y.resize(m_capacity);
+    m_previousX.resize(m_capacity);
+    m_previousY.resize(m_capacity);
+    m_velocityX.resize(m_capacity);
+    m_velocityY.resize(m_capacity);
+    m_age.resize(m_capacity);
+    m_restTime.resize(m_capacity);
+    m_cellX.resize(m_capacity);
+    m_cellY.resize(m_capacity);
+    m_bucketGrains.resize(m_capacity);
+    m_sleepingGrains.resize(m_capacity);
+    m_waking.assign(m_capacity, 0);
+    m_vertices.reserve(2 * m_capacity);
+
+    // At least twice as many buckets as grains keeps unrelated cells apart.
+    unsigned buckets = 16;
+    while (buckets < 2u * m_capacity)
+        buckets *= 2;
+    m_bucketStart.assign(buckets + 1, 0);
+    m_sleepingStart.assign(buckets + 1, 0);
+    m_bucketMask = buckets - 1;
+    m_sleepingChanged = true;
+}
+
+void ParticleSystem::setColor(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+    m_color[0] = red;
+    m_color[1] = green;
+    m_color[2] = blue;
+    m_color[3] = alpha;
+}
+
+int ParticleSystem::emit(const HawkPoint& center, float speed, int count)
+{
+    count = std::min(count, m_capacity - m_count);
+    HawkVector origin = Hawk::toMeters(center);
+    float maxSpeed = Hawk::pix2M(speed);
+
+    for (int i = 0; i < count; ++i) {
+        float random[3];
+        for (int k = 0; k < 3; ++k) {
+            m_seed ^= m_seed << 13;
+            m_seed ^= m_seed >> 17;
+            m_seed ^= m_seed << 5;
+            random[k] = (m_seed % 1000) / 1000.f;
+        }
+
+        // A fan opening upwards, spread over a few grains so they do not start stacked.
+        float angle = b2_pi * (0.15f + 0.7f * random[0]);
+        float velocity = maxSpeed * (0.5f + 0.5f * random[1]);
+        float offset = 4 * m_radius * (random[2] - 0.5f);
+
+        // New grains are awake, so the first sleeping grain makes room.
+        int grain = m_awake++;
+        if (grain < m_count) {
+            copy(grain, m_count);
+            m_sleepingChanged = true;
+        }
+        ++m_count;
+
+        m_x[grain] = origin.x + offset;
+        m_y[grain] = origin.y + offset * random[0];
+        m_velocityX[grain] = velocity * cosf(angle);
+        m_velocityY[grain] = velocity * sinf(angle);
+        m_age[grain] = 0;
+        m_restTime[grain] = 0;
+    }
+    return count;
+}
+
+void ParticleSystem::update(float dt, const HawkVector& gravity, const TerrainIndex& terrain)
+{
+    if (!m_count || dt <= 0)
+        return;
+
+    if (m_sleepingChanged) {
+        buildHash(m_awake, m_count, m_sleepingStart, m_sleepingGrains);
+        m_sleepingChanged = false;
+    }
+
+    integrate(dt, gravity);
+    buildHash(0, m_awake, m_bucketStart, m_bucketGrains);
+    separate();
+    collideSleeping();
+    collideTerrain(terrain);
+    updateVelocities(dt);
+    updateSleep(dt);
+    retire(dt);
+}
+
+void ParticleSystem::invalidateTerrain()
+{
+    m_terrainCache.clear();
+
+    // Grains resting on terrain that is gone have to fall.
+    std::fill(m_restTime.begin(), m_restTime.begin() + m_count, 0.f);
+    m_awake = m_count;
+    m_sleepingChanged = true;
+}
+
+void ParticleSystem::integrate(float dt, const HawkVector& gravity)
+{
+    float* x = &m_x[0];
+    float* y = &m_y[0];
+    float* vx = &m_velocityX[0];
+    float* vy = &m_velocityY[0];
+
+    int vectorEnd = HAWK_SIMD ? m_awake & ~3 : 0;
+    HawkFloat4 step = hawkSplat4(dt);
+    HawkFloat4 pullX = hawkSplat4(gravity.x * dt);
+    HawkFloat4 pullY = hawkSplat4(gravity.y * dt);
+    HawkFloat4 fastest = hawkSplat4(MaxSpeed);
+    HawkFloat4 slowest = hawkSplat4(-MaxSpeed);
+    for (int i = 0; i < vectorEnd; i += 4) {
+        HawkFloat4 px = hawkLoad4(x + i);
+        HawkFloat4 py = hawkLoad4(y + i);
+        HawkFloat4 velocityX = hawkMax4(hawkMin4(hawkAdd4(hawkLoad4(vx + i), pullX), fastest), slowest);
+        HawkFloat4 velocityY = hawkMax4(hawkMin4(hawkAdd4(hawkLoad4(vy + i), pullY), fastest), slowest);
+        hawkStore4(&m_previousX[i], px);
+        hawkStore4(&m_previousY[i], py);
+        hawkStore4(x + i, hawkAdd4(px, hawkMul4(velocityX, step)));
+        hawkStore4(y + i, hawkAdd4(py, hawkMul4(velocityY, step)));
+    }
+
+    for (int i = vectorEnd; i < m_awake; ++i) {
+        float velocityX = std::max(-MaxSpeed, std::min(vx[i] + gravity.x * dt, MaxSpeed));
+        float velocityY = std::max(-MaxSpeed, std::min(vy[i] + gravity.y * dt, MaxSpeed));
+        m_previousX[i] = x[i];
+        m_previousY[i] = y[i];
+        x[i] += velocityX * dt;
+        y[i] += velocityY * dt;
+    }
+}
+
+// Counting sort of grains begin to end by bucket, so each bucket is one contiguous run.
+void ParticleSystem::buildHash(int begin, int end, std::vector<int>& bucketStart, std::vector<int>& bucketGrains)
+{
+    float inverseCell = 1 / (2 * m_radius);
+    unsigned buckets = m_bucketMask + 1;
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+
+    for (int i = begin; i < end; ++i) {
+        m_cellX[i] = static_cast<int>(floorf(m_x[i] * inverseCell));
+        m_cellY[i] = static_cast<int>(floorf(m_y[i] * inverseCell));
+        ++bucketStart[hashCell(m_cellX[i], m_cellY[i]) & m_bucketMask];
+    }
+
+    // Turn counts into run ends, then fill each run from its end back to its start.
+    int runEnd = 0;
+    for (unsigned b = 0; b <= buckets; ++b) {
+        runEnd += bucketStart[b];
+        bucketStart[b] = runEnd;
+    }
+    for (int i = begin; i < end; ++i)
+        bucketGrains[--bucketStart[hashCell(m_cellX[i], m_cellY[i]) & m_bucketMask]] = i;
+}
+
+void ParticleSystem::separate()
+{
+    const float diameter = 2 * m_radius;
+
+    for (int i = 0; i < m_awake; ++i) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int cellX = m_cellX[i] + dx;
+                int cellY = m_cellY[i] + dy;
+                unsigned bucket = hashCell(cellX, cellY) & m_bucketMask;
+
+                for (int k = m_bucketStart[bucket]; k < m_bucketStart[bucket + 1]; ++k) {
+                    int j = m_bucketGrains[k];
+                    // Each pair once, and only grains really in this cell.
+                    if (j <= i || m_cellX[j] != cellX || m_cellY[j] != cellY)
+                        continue;
+
+                    float offsetX = m_x[j] - m_x[i];
+                    float offsetY = m_y[j] - m_y[i];
+                    float distanceSquared = offsetX * offsetX + offsetY * offsetY;
+                    if (distanceSquared >= diameter * diameter || distanceSquared < FLT_EPSILON)
+                        continue;
+
+                    float distance = sqrtf(distanceSquared);
+                    float push = Stiffness * (diameter - distance) / distance;
+                    float shareJ = 0.5f + StackBias * offsetY / distance;
+                    m_x[i] -= (1 - shareJ) * push * offsetX;
+                    m_y[i] -= (1 - shareJ) * push * offsetY;
+                    m_x[j] += shareJ * push * offsetX;
+                    m_y[j] += shareJ * push * offsetY;
+                }
+            }
+        }
+    }
+}
+
+// Sleeping grains do not give way: awake grains take the whole push, and wake
+// them up if they came in fast.
+void ParticleSystem::collideSleeping()
+{
+    if (m_awake == m_count)
+        return;
+
+    const float diameter = 2 * m_radius;
+    const float inverseCell = 1 / diameter;
+
+    for (int i = 0; i < m_awake; ++i) {
+        bool fast = m_velocityX[i] * m_velocityX[i] + m_velocityY[i] * m_velocityY[i] > WakeSpeed * WakeSpeed;
+        // Cells from the position after separate() moved the grain.
+        int centerX = static_cast<int>(floorf(m_x[i] * inverseCell));
+        int centerY = static_cast<int>(floorf(m_y[i] * inverseCell));
+
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int cellX = centerX + dx;
+                int cellY = centerY + dy;
+                unsigned bucket = hashCell(cellX, cellY) & m_bucketMask;
+
+                for (int k = m_sleepingStart[bucket]; k < m_sleepingStart[bucket + 1]; ++k) {
+                    int j = m_sleepingGrains[k];
+                    if (m_cellX[j] != cellX || m_cellY[j] != cellY)
+                        continue;
+
+                    float offsetX = m_x[i] - m_x[j];
+                    float offsetY = m_y[i] - m_y[j];
+                    float distanceSquared = offsetX * offsetX + offsetY * offsetY;
+                    if (distanceSquared >= diameter * diameter || distanceSquared < FLT_EPSILON)
+                        continue;
+
+                    float distance = sqrtf(distanceSquared);
+                    float push = Stiffness * (diameter - distance) / distance;
+                    m_x[i] += push * offsetX;
+                    m_y[i] += push * offsetY;
+                    if (fast)
+                        m_waking[j] = 1;
+                }
+            }
+        }
+    }
+}
+
+const std::vector<b2Fixture*>& ParticleSystem::terrainAround(const TerrainIndex& terrain, int cellX, int cellY)
+{
+    CellKey key(cellX, cellY);
+    std::map<CellKey, std::vector<b2Fixture*> >::iterator cached = m_terrainCache.find(key);
+    if (cached != m_terrainCache.end())
+        return cached->second;
+
+    if (m_terrainCache.size() >= MaxCachedCells)
+        m_terrainCache.clear();
+
+    std::vector<b2Fixture*>& fixtures = m_terrainCache[key];
+    b2AABB aabb;
+    aabb.lowerBound = HawkVector(cellX * TerrainCellSize - m_radius, cellY * TerrainCellSize - m_radius);
+    aabb.upperBound = HawkVector((cellX + 1) * TerrainCellSize + m_radius, (cellY + 1) * TerrainCellSize + m_radius);
+    FixtureCollector collector(fixtures);
+    terrain.query(&collector, aabb);
+    return fixtures;
+}
+
+void ParticleSystem::collideTerrain(const TerrainIndex& terrain)
+{
+    // Grains come in clumps, so consecutive grains usually share a terrain cell.
+    const std::vector<b2Fixture*>* fixtures = 0;
+    int lastX = 0, lastY = 0;
+
+    for (int i = 0; i < m_awake; ++i) {
+        int cellX = static_cast<int>(floorf(m_x[i] / TerrainCellSize));
+        int cellY = static_cast<int>(floorf(m_y[i] / TerrainCellSize));
+        if (!fixtures || cellX != lastX || cellY != lastY) {
+            fixtures = &terrainAround(terrain, cellX, cellY);
+            lastX = cellX;
+            lastY = cellY;
+        }
+
+        b2Vec2 point(m_x[i], m_y[i]);
+        b2Vec2 previous(m_previousX[i], m_previousY[i]);
+        for (unsigned f = 0; f < fixtures->size(); ++f) {
+            b2Vec2 normal;
+            if (!pushOut((*fixtures)[f], m_radius, previous, point, normal))
+                continue;
+
+            // Friction takes away part of this step's motion along the surface.
+            b2Vec2 moved(point.x - m_previousX[i], point.y - m_previousY[i]);
+            b2Vec2 sliding = moved - b2Dot(moved, normal) * normal;
+            point -= m_friction * sliding;
+        }
+        m_x[i] = point.x;
+        m_y[i] = point.y;
+    }
+}
+
+void ParticleSystem::updateVelocities(float dt)
+{
+    int vectorEnd = HAWK_SIMD ? m_awake & ~3 : 0;
+    HawkFloat4 inverseStep = hawkSplat4(1 / dt);
+    for (int i = 0; i < vectorEnd; i += 4) {
+        hawkStore4(&m_velocityX[i], hawkMul4(hawkSub4(hawkLoad4(&m_x[i]), hawkLoad4(&m_previousX[i])), inverseStep));
+        hawkStore4(&m_velocityY[i], hawkMul4(hawkSub4(hawkLoad4(&m_y[i]), hawkLoad4(&m_previousY[i])), inverseStep));
+    }
+
+    for (int i = vectorEnd; i < m_awake; ++i) {
+        m_velocityX[i] = (m_x[i] - m_previousX[i]) / dt;
+        m_velocityY[i] = (m_y[i] - m_previousY[i]) / dt;
+    }
+}
+
+void ParticleSystem::updateSleep(float dt)
+{
+    // Sleeping grains that were hit join the awake ones at the boundary.
+    for (int j = m_awake; j < m_count; ++j) {
+        if (!m_waking[j])
+            continue;
+        m_waking[j] = 0;
+        m_restTime[j] = 0;
+        swap(j, m_awake++);
+        m_sleepingChanged = true;
+    }
+
+    // Walk down so grains swapped in from the boundary have been checked already.
+    for (int i = m_awake - 1; i >= 0; --i) {
+        if (m_velocityX[i] * m_velocityX[i] + m_velocityY[i] * m_velocityY[i] > SleepSpeed * SleepSpeed) {
+            m_restTime[i] = 0;
+            continue;
+        }
+        m_restTime[i] += dt;
+        if (m_restTime[i] < TimeToSleep)
+            continue;
+
+        m_velocityX[i] = 0;
+        m_velocityY[i] = 0;
+        swap(i, --m_awake);
+        m_sleepingChanged = true;
+    }
+}
+
+void ParticleSystem::retire(float dt)
+{
+    for (int i = m_count - 1; i >= 0; --i) {
+        m_age[i] += dt;
+        if (m_age[i] >= m_lifetime || m_y[i] < m_killY)
+            remove(i);
+    }
+}
+
+// Keeps the awake grains in front: an awake grain is replaced by the last awake
+// one, whose place the last sleeping grain takes.
+void ParticleSystem::remove(int index)
+{
+    int last = --m_count;
+    if (index < m_awake) {
+        int lastAwake = --m_awake;
+        copy(lastAwake, index);
+        index = lastAwake;
+    }
+    if (index != last) {
+        copy(last, index);
+        m_sleepingChanged = true;
+    }
+}
+
+void ParticleSystem::copy(int from, int to)
+{
+    m_x[to] = m_x[from];
+    m_y[to] = m_y[from];
+    m_previousX[to] = m_previousX[from];
+    m_previousY[to] = m_previousY[from];
+    m_velocityX[to] = m_velocityX[from];
+    m_velocityY[to] = m_velocityY[from];
+    m_age[to] = m_age[from];
+    m_restTime[to] = m_restTime[from];
+}
+
+void ParticleSystem::swap(int a, int b)
+{
+    std::swap(m_x[a], m_x[b]);
+    std::swap(m_y[a], m_y[b]);
+    std::swap(m_previousX[a], m_previousX[b]);
+    std::swap(m_previousY[a], m_previousY[b]);
+    std::swap(m_velocityX[a], m_velocityX[b]);
+    std::swap(m_velocityY[a], m_velocityY[b]);
+    std::swap(m_age[a], m_age[b]);
+    std::swap(m_restTime[a], m_restTime[b]);
+}
+
+void ParticleSystem::clear()
+{
+    m_count = 0;
+    m_awake = 0;
+    m_sleepingChanged = true;
+    m_seed = InitialSeed;
+}
+
+void ParticleSystem::draw()
+{
+    if (!m_count)
+        return;
+
+    m_vertices.clear();
+    for (int i = 0; i < m_count; ++i) {
+        m_vertices.push_back(m_x[i]);
+        m_vertices.push_back(m_y[i]);
+    }
+
+    glDisable(GL_TEXTURE_2D);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    glPushMatrix();
+    glScalef(Hawk::m2Pix(1.f), Hawk::m2Pix(1.f), 1.0f);
+    glPointSize(std::max(1.f, Hawk::m2Pix(2 * m_radius)));
+    glColor4ub(m_color[0], m_color[1], m_color[2], m_color[3]);
+    glVertexPointer(2, GL_FLOAT, 0, &m_vertices[0]);
+    glDrawArrays(GL_POINTS, 0, m_count);
+    glPopMatrix();
+
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnable(GL_TEXTURE_2D);
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+}
@@ -0,0 +1,135 @@
+/*
+ * ParticleSystem.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef PARTICLESYSTEM_H_
+#define PARTICLESYSTEM_H_
+
+#include "HawkEngine.h"
+#include "TerrainIndex.h"
+
+#include <GLES/gl.h>
+
+#include <map>
+#include <vector>
+
+class ParticleSystem {
+public:
+    /**
+     * Sand and gravel: small round grains that pile against the static terrain
+     * without being Box2D bodies.
+     *
+     * Grains are stored as parallel arrays and stepped position-based: a SIMD pass
+     * predicts new positions, neighbouring grains found through a spatial hash are
+     * pushed apart, grains are pushed out of terrain fixtures, and a second SIMD
+     * pass turns the corrected positions back into velocities. Grains never touch
+     * dynamic bodies. Terrain fixtures are looked up through a TerrainIndex once
+     * per terrain cell and cached until invalidateTerrain().
+     *
+     * Like Box2D bodies, grains that stay slow for half a second fall asleep and
+     * cost next to nothing until a fast grain hits them or the terrain changes.
+     * Awake grains are not cheap: about a third of a microsecond each on a
+     * desktop, so 4096 grains pouring take around a millisecond a step, ten times
+     * a settling pile of 250 boxes. The same grains at rest take a few hundredths
+     * of a millisecond.
+     *
+     * emit() and the kill plane are in pixels; everything else is in metres.
+     */
+    ParticleSystem();
+
+    // Allocates room for capacity grains of the given radius, in pixels.
+    void create(int capacity, float radius);
+
+    void setColor(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha);
+    void setLifetime(float seconds) { m_lifetime = seconds; }
+    // Fraction of sliding motion lost per step while touching terrain.
+    void setFriction(float friction) { m_friction = friction; }
+    void setKillPlane(float y) { m_killY = Hawk::pix2M(y); }
+
+    /**
+     * Throws up to count grains upwards from center, with speeds up to speed
+     * pixels per second. Returns how many were emitted; grains beyond the
+     * capacity are dropped.
+     */
+    int emit(const HawkPoint& center, float speed, int count);
+
+    void update(float dt, const HawkVector& gravity, const TerrainIndex&);
+
+    // Forgets the cached terrain fixtures and wakes every grain. Call whenever
+    // the TerrainIndex is rebuilt.
+    void invalidateTerrain();
+
+    void clear();
+
+    // All grains in one GL_POINTS draw.
+    void draw();
+
+    int count() const { return m_count; }
+    int awakeCount() const { return m_awake; }
+    int capacity() const { return m_capacity; }
+
+private:
+    enum { MaxCachedCells = 4096 };
+
+    typedef std::pair<int, int> CellKey;
+
+    void integrate(float dt, const HawkVector& gravity);
+    void buildHash(int begin, int end, std::vector<int>& bucketStart, std::vector<int>& bucketGrains);
+    void separate();
+    void collideSleeping();
+    void collideTerrain(const TerrainIndex&);
+    const std::vector<b2Fixture*>& terrainAround(const TerrainIndex&, int cellX, int cellY);
+    void updateVelocities(float dt);
+    void updateSleep(float dt);
+    void retire(float dt);
+    void remove(int index);
+    void copy(int from, int to);
+    void swap(int a, int b);
+
+    int m_capacity;
+    int m_count;
+    // Grains below this index are awake, the rest asleep.
+    int m_awake;
+    float m_radius;
+    float m_lifetime;
+    float m_friction;
+    float m_killY;
+    unsigned m_seed;
+
+    // One entry per grain, swapped with the last grain on removal.
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_previousX;
+    std::vector<float> m_previousY;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<float> m_age;
+    // Seconds each grain has been slow enough to sleep.
+    std::vector<float> m_restTime;
+
+    // Spatial hashes over cells one grain wide, one of the awake grains rebuilt
+    // every step and one of the sleeping grains rebuilt only when they change.
+    // m_bucketStart[b] to m_bucketStart[b + 1] are the entries of m_bucketGrains
+    // in bucket b; m_cellX/m_cellY tell apart cells that share a bucket.
+    std::vector<int> m_bucketStart;
+    std::vector<int> m_bucketGrains;
+    std::vector<int> m_sleepingStart;
+    std::vector<int> m_sleepingGrains;
+    std::vector<int> m_cellX;
+    std::vector<int> m_cellY;
+    unsigned m_bucketMask;
+    bool m_sleepingChanged;
+
+    // Sleeping grains hit hard enough this step to wake up.
+    std::vector<unsigned char> m_waking;
+
+    // Static fixtures near each terrain cell that grains have visited.
+    std::map<CellKey, std::vector<b2Fixture*> > m_terrainCache;
+
+    GLubyte m_color[4];
+    std::vector<GLfloat> m_vertices;
+};
+
+#endif /* PARTICLESYSTEM_H_ */
@@ -0,0 +1,110 @@
+/*
+ * PhysicsStats.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "PhysicsStats.h"
+
+#include <string.h>
+
+PhysicsStats::PhysicsStats()
+    : m_steps(0)
+    , m_log(0)
+{
+    memset(&m_last, 0, sizeof(m_last));
+}
+
+PhysicsStats::~PhysicsStats()
+{
+    closeLog();
+}
+
+bool PhysicsStats::openLog(const char* path)
+{
+    closeLog();
+
+    m_log = fopen(path, "w");
+    if (!m_log) {
+        fprintf(stderr, "Cannot open physics stats log %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+void PhysicsStats::closeLog()
+{
+    if (m_log)
+        fclose(m_log);
+    m_log = 0;
+}
+
+const PhysicsStepStats& PhysicsStats::collect(const b2World* world)
+{
+    PhysicsStepStats& stats = m_last;
+    memset(&stats, 0, sizeof(stats));
+    stats.step = m_steps++;
+
+    for (const b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        switch (body->GetType()) {
+        case b2_staticBody:
+            ++stats.staticBodies;
+            continue;
+        case b2_kinematicBody:
+            ++stats.kinematicBodies;
+            break;
+        case b2_dynamicBody:
+            ++stats.dynamicBodies;
+            break;
+        }
+
+        if (body->IsAwake() && body->IsActive())
+            ++stats.awakeBodies;
+    }
+
+    for (const b2Contact* contact = world->GetContactList(); contact; contact = contact->GetNext()) {
+        ++stats.contacts;
+        if (contact->IsTouching())
+            ++stats.touchingContacts;
+    }
+
+    stats.proxies = world->GetProxyCount();
+    stats.treeHeight = world->GetTreeHeight();
+    stats.treeQuality = world->GetTreeQuality();
+
+    const b2Profile& profile = world->GetProfile();
+    stats.stepTime = profile.step;
+    stats.collideTime = profile.collide;
+    stats.solveTime = profile.solve;
+    stats.broadphaseTime = profile.broadphase;
+    stats.toiTime = profile.solveTOI;
+#ifdef B2_PROFILE_COUNTS
+    stats.islands = profile.islandCount;
+    stats.islandBodies = profile.islandBodyCount;
+    stats.largestIsland = profile.largestIsland;
+    stats.toiEvents = profile.toiEventCount;
+#endif
+
+    if (m_log)
+        writeLog();
+    return stats;
+}
+
+void PhysicsStats::writeLog()
+{
+    const PhysicsStepStats& s = m_last;
+    fprintf(m_log, "{\"step\":%u,\"static\":%d,\"kinematic\":%d,\"dynamic\":%d,\"awake\":%d,\"proxies\":%d,\"tree_height\":%d,"
+        "\"tree_quality\":%.2f,\"contacts\":%d,\"touching\":%d,\"islands\":%d,\"island_bodies\":%d,\"largest_island\":%d,\"toi_events\":%d,"
+        "\"step_ms\":%.3f,\"collide_ms\":%.3f,\"solve_ms\":%.3f,\"broadphase_ms\":%.3f,\"toi_ms\":%.3f}\n",
+        s.step, s.staticBodies, s.kinematicBodies, s.dynamicBodies, s.awakeBodies, s.proxies, s.treeHeight,
+        s.treeQuality, s.contacts, s.touchingContacts, s.islands, s.islandBodies, s.largestIsland, s.toiEvents,
+        s.stepTime, s.collideTime, s.solveTime, s.broadphaseTime, s.toiTime);
+}
+
+void PhysicsStats::format(char* buffer, int size) const
+{
+    const PhysicsStepStats& s = m_last;
+    snprintf(buffer, size, "awake %d/%d  contacts %d/%d  islands %d (max %d)  step %.2fms  toi %d %.2fms",
+        s.awakeBodies, s.kinematicBodies + s.dynamicBodies, s.touchingContacts, s.contacts, s.islands, s.largestIsland,
+        s.stepTime, s.toiEvents, s.toiTime);
+}
@@ -0,0 +1,76 @@
+/*
+ * PhysicsStats.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef PHYSICSSTATS_H_
+#define PHYSICSSTATS_H_
+
+#include "HawkEngine.h"
+
+#include <stdio.h>
+
+// What the world looked like after one step.
+struct PhysicsStepStats {
+    unsigned step;
+
+    int staticBodies;
+    int kinematicBodies;
+    int dynamicBodies;
+    int awakeBodies;
+
+    int proxies;
+    int treeHeight;
+    float treeQuality;
+
+    int contacts;
+    int touchingContacts;
+
+    // Islands Box2D solved, with their dynamic and kinematic bodies in total
+    // and in the largest one, and the TOI events continuous collision solved.
+    // Zero without Res/Box2D_patches, which count them in b2Profile.
+    int islands;
+    int islandBodies;
+    int largestIsland;
+    int toiEvents;
+
+    // From b2World::GetProfile(), in milliseconds.
+    float stepTime;
+    float collideTime;
+    float solveTime;
+    float broadphaseTime;
+    float toiTime;
+};
+
+class PhysicsStats {
+public:
+    /**
+     * Counts bodies, broadphase proxies and contacts after each step, and reads
+     * the step's times, island sizes and TOI events from b2World::GetProfile().
+     * A collection walks every body and contact once, so only enable it while
+     * looking at the numbers. With a log open every step is written as one JSON line.
+     */
+    PhysicsStats();
+    ~PhysicsStats();
+
+    bool openLog(const char* path);
+    void closeLog();
+
+    // Call right after b2World::Step.
+    const PhysicsStepStats& collect(const b2World*);
+
+    const PhysicsStepStats& last() const { return m_last; }
+
+    // A one line summary for overlays.
+    void format(char* buffer, int size) const;
+
+private:
+    void writeLog();
+
+    PhysicsStepStats m_last;
+    unsigned m_steps;
+    FILE* m_log;
+};
+
+#endif /* PHYSICSSTATS_H_ */
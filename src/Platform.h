@@ -30,6 +30,8 @@
 
 #include <sqlite3.h>
 
+#include "HawkControl.h"
+
 #include <vector>
 #include <string>
 
@@ -88,19 +90,6 @@ public:
     char analog1String[128];
 };
 
-enum HawkControl {
-    MoveLeft,
-    MoveRight,
-    MoveUp,
-    MoveDown,
-    ActionA,
-    ActionB,
-    ActionX,
-    ActionY,
-    Menu1,
-    Menu2,
-};
-
 /**
  * Methods of this class are called by Platform whenever the game may need to
  * "do something"
@@ -15,6 +15,11 @@
  */
 
 #include "Sound.h"
+#include "AudioDecoder.h"
+#include "AudioThread.h"
+#include "ClipCache.h"
+#include "MappedWav.h"
+#include "VoicePool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,8 +33,19 @@
 
 static const int BufferSize = 1 * 1024 * 1024;
 
+// A streamed sound keeps this many buffers of this size queued, about 1.5 s of
+// 44.1 kHz 16 bit stereo in all.
+static const int StreamBufferCount = 4;
+static const int StreamBufferSize = 64 * 1024;
+
 Sound::Sound()
-    : m_source(0) {
+    : m_source(0)
+    , m_clips(0)
+    , m_clip(0)
+    , m_priority(0)
+    , m_reader(0)
+    , m_playing(false)
+    , m_audio(0) {
 }
 
 Sound::~Sound() {
@@ -38,33 +54,39 @@ Sound::~Sound() {
     }
 }
 
-bool Sound::load(const char* fileName) {
+bool Sound::load(const char* fileName, ClipCache* clips, int priority) {
     ASSERT(!isLoaded());
 
-    // Clear any old ALUT error
-    alutGetError();
-
-    ALenum format;
-    ALsizei size;
-    ALfloat frequency;
-    unsigned char* rawData = static_cast<unsigned char*>(alutLoadMemoryFromFile(fileName, &format, &size, &frequency));
+    if (clips) {
+        m_clip = clips->acquire(fileName);
+        if (!m_clip) {
+            return false;
+        }
+        m_clips = clips;
+        m_priority = priority;
+        return true;
+    }
 
-    ALenum error = alutGetError();
-    if (error != ALUT_ERROR_NO_ERROR) {
-        fprintf(stderr, "Cannot load background file into memory: %d, %s\n", error, alutGetErrorString(error));
-        free(rawData);
+    // The buffers are filled straight from the mapped file.
+    MappedWav wav;
+    if (!wav.open(fileName)) {
         return false;
     }
 
+    ALenum format = wav.format();
+    ALsizei size = wav.size();
+    ALsizei frequency = wav.frequency();
+    const unsigned char* rawData = static_cast<const unsigned char*>(wav.data());
+
     m_buffers.resize(size / BufferSize + 1);
 
     // Clear old AL error
     alGetError();
     alGenBuffers(m_buffers.size(), &m_buffers[0]);
-    error = alGetError();
+    ALenum error = alGetError();
     if (error != AL_NO_ERROR) {
         fprintf(stderr, "Cannot generate background buffers: %d\n", error);
-        free(rawData);
+        m_buffers.clear();
         return false;
     }
 
@@ -72,7 +94,6 @@ bool Sound::load(const char* fileName) {
     error = alGetError();
     if (error != AL_NO_ERROR) {
         fprintf(stderr, "Cannot generate background source: %d\n", error);
-        free(rawData);
         alDeleteBuffers(m_buffers.size(), &m_buffers[0]);
         m_buffers.clear();
         return false;
@@ -88,7 +109,6 @@ bool Sound::load(const char* fileName) {
         error = alGetError();
         if (error != AL_NO_ERROR) {
             fprintf(stderr, "Cannot copy raw background music into buffer: %d\n", error);
-            free(rawData);
             alDeleteBuffers(m_buffers.size(), &m_buffers[0]);
             m_buffers.clear();
             alDeleteSources(1, &m_source);
@@ -100,7 +120,6 @@ bool Sound::load(const char* fileName) {
         error = alGetError();
         if (error != AL_NO_ERROR) {
             fprintf(stderr, "Cannot queue background buffer: %d\n", error);
-            free(rawData);
             alDeleteBuffers(m_buffers.size(), &m_buffers[0]);
             m_buffers.clear();
             alDeleteSources(1, &m_source);
@@ -109,29 +128,174 @@ bool Sound::load(const char* fileName) {
         }
     }
 
-    free(rawData);
     return true;
 }
 
-void Sound::play() const {
-    if (isLoaded()) {
-        alSourcePlay(m_source);
+bool Sound::stream(const char* fileName) {
+    ASSERT(!isLoaded());
+
+    m_reader = AudioDecoder::create(fileName);
+    if (!m_reader) {
+        return false;
+    }
+    m_streamData.resize(StreamBufferSize);
+
+    // Clear old AL error
+    alGetError();
+    m_buffers.resize(StreamBufferCount);
+    alGenBuffers(m_buffers.size(), &m_buffers[0]);
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot generate stream buffers: %d\n", error);
+        m_buffers.clear();
+        delete m_reader;
+        m_reader = 0;
+        return false;
+    }
+
+    alGenSources(1, &m_source);
+    error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot generate stream source: %d\n", error);
+        alDeleteBuffers(m_buffers.size(), &m_buffers[0]);
+        m_buffers.clear();
+        delete m_reader;
+        m_reader = 0;
+        return false;
+    }
+
+    for (unsigned int i = 0; i < m_buffers.size(); i++) {
+        if (!fillStreamBuffer(m_buffers[i])) {
+            unload();
+            return false;
+        }
+
+        alSourceQueueBuffers(m_source, 1, &m_buffers[i]);
+        error = alGetError();
+        if (error != AL_NO_ERROR) {
+            fprintf(stderr, "Cannot queue stream buffer: %d\n", error);
+            unload();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Sound::fillStreamBuffer(ALuint buffer) {
+    // Wrap around at the end of the file within the same buffer, so there is
+    // no short buffer and no gap when the sound loops.
+    int filled = 0;
+    bool rewound = false;
+    while (filled < StreamBufferSize) {
+        int count = m_reader->read(&m_streamData[filled], StreamBufferSize - filled);
+        if (count < 0) {
+            fprintf(stderr, "Cannot read stream data\n");
+            return false;
+        }
+        if (count == 0) {
+            // An empty data chunk would wrap forever.
+            if (rewound || !m_reader->rewind()) {
+                break;
+            }
+            rewound = true;
+            continue;
+        }
+        filled += count;
+        rewound = false;
+    }
+
+    if (filled == 0) {
+        fprintf(stderr, "Stream has no data\n");
+        return false;
+    }
+
+    alBufferData(buffer, m_reader->format(), &m_streamData[0], filled, m_reader->frequency());
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot copy stream data into buffer: %d\n", error);
+        return false;
+    }
+    return true;
+}
+
+void Sound::play(float gain) const {
+    if (m_audio) {
+        AudioCommand command = { AudioCommand::Play, this, gain };
+        m_audio->post(command);
+    } else {
+        playNow(gain);
     }
 }
 
 void Sound::pause() const {
-    if (isLoaded()) {
+    if (m_audio) {
+        AudioCommand command = { AudioCommand::Pause, this, 0 };
+        m_audio->post(command);
+    } else {
+        pauseNow();
+    }
+}
+
+void Sound::stop() const {
+    if (m_audio) {
+        AudioCommand command = { AudioCommand::Stop, this, 0 };
+        m_audio->post(command);
+    } else {
+        stopNow();
+    }
+}
+
+void Sound::setGain(float gain) const {
+    if (m_audio) {
+        AudioCommand command = { AudioCommand::SetGain, this, gain };
+        m_audio->post(command);
+    } else {
+        setGainNow(gain);
+    }
+}
+
+void Sound::playNow(float gain) const {
+    if (m_clips) {
+        m_clips->voices().play(m_clip, m_priority, gain);
+    } else if (isLoaded()) {
+        alSourcef(m_source, AL_GAIN, gain);
+        alSourcePlay(m_source);
+        m_playing = true;
+    }
+}
+
+void Sound::pauseNow() const {
+    if (m_clips) {
+        m_clips->voices().stop(m_clip);
+    } else if (isLoaded()) {
         alSourcePause(m_source);
     }
 }
 
+void Sound::stopNow() const {
+    if (m_clips) {
+        m_clips->voices().stop(m_clip);
+    } else if (isLoaded()) {
+        alSourceStop(m_source);
+        m_playing = false;
+    }
+}
+
+void Sound::setGainNow(float gain) const {
+    if (!m_clips && isLoaded()) {
+        alSourcef(m_source, AL_GAIN, gain);
+    }
+}
+
 void Sound::tick() {
     ALenum error;
 
     // Clear any previous error
     alGetError();
 
-    if (isLoaded()) {
+    // Pooled sounds have nothing to re-queue.
+    if (m_source) {
         ALint processedBuffers;
         alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processedBuffers);
         if ((error = alGetError()) != AL_NO_ERROR) {
@@ -148,6 +312,10 @@ void Sound::tick() {
                 return;
             }
 
+            if (m_reader && !fillStreamBuffer(buffer)) {
+                return;
+            }
+
             alSourceQueueBuffers(m_source, 1, &buffer);
             error = alGetError();
             if (error != AL_NO_ERROR) {
@@ -167,7 +335,7 @@ void Sound::tick() {
             return;
         }
 
-        if (state != AL_PLAYING && state != AL_PAUSED) {
+        if (m_playing && state != AL_PLAYING && state != AL_PAUSED) {
             fprintf(stderr, "Background music has stalled\n");
 
             ALint queuedBuffers = 0;
@@ -194,11 +362,20 @@ void Sound::unload() {
     // Stop the background music and clear the queue.
     ASSERT(isLoaded());
     if (isLoaded()) {
+        if (m_clips) {
+            m_clips->release(m_clip);
+            m_clips = 0;
+            m_clip = 0;
+            return;
+        }
         alSourceStop(m_source);
         alSourcei(m_source, AL_BUFFER, 0);
         alDeleteSources(1, &m_source);
         m_source = 0;
         alDeleteBuffers(m_buffers.size(), &m_buffers[0]);
         m_buffers.clear();
+        delete m_reader;
+        m_reader = 0;
+        m_streamData.clear();
     }
 }
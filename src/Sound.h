@@ -22,10 +22,14 @@
 #ifndef SOUND_H_
 #define SOUND_H_
 
-#include <AL/alut.h>
+#include <AL/al.h>
 
 #include <vector>
 
+class AudioThread;
+class AudioDecoder;
+class ClipCache;
+
 /**
  * Play a sound
  */
@@ -44,34 +48,80 @@ public:
      * Loads a WAV file and places it into one or more buffers.  These buffers
      * are then attached to a source for playing and/or streaming.
      *
+     * With a clip cache the sound only takes a reference to the cache's single
+     * buffer for the file, loading it if no other sound has (Ogg Vorbis files
+     * are decoded whole into it), and creates no
+     * source; every play() borrows a voice from the cache's pool instead, so the
+     * sound can overlap itself and other effects.
+     *
      * @param fileName The WAV file to load.
+     * @param clips Cache to share the buffer through, or 0 for buffers and a
+     *        source of its own.
+     * @param priority Voices of lower priority are stolen for this sound.
      * @return True if the file was successfully loaded.  Otherwise returns
      *         false.
      */
-    bool load(const char* fileName);
+    bool load(const char* fileName, ClipCache* clips = 0, int priority = 0);
+
+    /**
+     * Stream a WAV or Ogg Vorbis file.
+     *
+     * Opens the file and queues a small ring of buffers filled from its start.
+     * Vorbis is decoded as each buffer is filled, so with an audio thread the
+     * decoding never runs on the game thread.
+     * tick() refills each buffer from the file as soon as it has played, going
+     * back to the start of the file at its end, so the sound loops without a gap
+     * and only the ring is ever held in memory.
+     *
+     * @param fileName The file to stream; .ogg files are decoded as Vorbis.
+     * @return True if the file was opened and the first buffers queued.
+     *         Otherwise returns false.
+     */
+    bool stream(const char* fileName);
 
     /**
      * Start playing the sound
      *
      * If this is called it will play a sound until it completes.  To loop the
      * sound the caller has to make frequent calls to tick().
+     *
+     * @param gain Volume, from 0 to 1.
      */
-    void play() const;
+    void play(float gain = 1.0f) const;
 
     /**
      * Pause playing the sound
      *
      * Stops playing the sound, but maintains position in the sound buffer.
      * When play() is called, sound resumes from the point pause() was called.
+     * Pooled sounds are stopped instead, since play() always starts them anew.
      */
     void pause() const;
 
+    /**
+     * Stop playing the sound
+     *
+     * The next play() starts from the beginning of the queued buffers.
+     */
+    void stop() const;
+
+    /**
+     * Change the volume of the sound while it plays.
+     *
+     * Pooled sounds take their volume from play() instead; this is a no-op
+     * for them.
+     *
+     * @param gain Volume, from 0 to 1.
+     */
+    void setGain(float gain) const;
+
     /**
      * Stream background buffers, if loaded.
      *
      * This method should be called frequently.  It will query the music source
      * to see how many buffers have finished playing.  It will then dequeue
-     * each of these finished buffers and then queue them up again.
+     * each of these finished buffers and then queue them up again, refilled
+     * from the file first if the sound is streamed.
      *
      * If no sound is loaded this is a no-op.  If pause() was called, this
      * will NOT resume (call play() to accomplish that).
@@ -90,11 +140,42 @@ public:
     /**
      * Returns whether the sound was properly loaded and ready to play.
      */
-    bool isLoaded() const { return (m_source != 0); }
+    bool isLoaded() const { return !m_buffers.empty() || m_clip != 0; }
+
+    /**
+     * Returns whether the sound is streamed from its file and so needs tick().
+     */
+    bool isStreamed() const { return m_reader != 0; }
 
 private:
+    friend class AudioThread;
+
+    // What play(), pause(), stop() and setGain() do, on the audio thread if there is one.
+    void playNow(float gain) const;
+    void pauseNow() const;
+    void stopNow() const;
+    void setGainNow(float gain) const;
+
+    bool fillStreamBuffer(ALuint buffer);
+
     std::vector<ALuint> m_buffers;
     ALuint m_source;
+
+    // Only set for cached sounds, which have neither buffers nor a source of their own.
+    ClipCache* m_clips;
+    ALuint m_clip;
+    int m_priority;
+
+    // Only set while streaming; m_streamData is the staging area for one buffer.
+    AudioDecoder* m_reader;
+    std::vector<char> m_streamData;
+
+    // Whether the source should be playing, so tick() restarts it after a stall
+    // but not after stop().
+    mutable bool m_playing;
+
+    // Set by AudioThread::add(); commands then go through its queue.
+    AudioThread* m_audio;
 };
 
 #endif /* SOUND_H_ */
@@ -121,3 +121,14 @@ void Sprite::draw() const {
     glBindTexture(GL_TEXTURE_2D, m_textureHandle);
     glDrawArrays(GL_TRIANGLE_STRIP, 0 , 4);
 }
+
+void Sprite::drawTriangles(const GLfloat* vertices, const GLfloat* textureCoordinates, int vertexCount) const {
+    if (!glIsTexture(m_textureHandle) || !vertexCount) {
+        return;
+    }
+
+    glVertexPointer(2, GL_FLOAT, 0, vertices);
+    glTexCoordPointer(2, GL_FLOAT, 0, textureCoordinates);
+    glBindTexture(GL_TEXTURE_2D, m_textureHandle);
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+}
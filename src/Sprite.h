@@ -34,10 +34,17 @@ public:
     void setSize(float w, float h);
     void draw() const;
 
+    // Draws GL_TRIANGLES cut from this sprite's texture; see TextureWidth().
+    void drawTriangles(const GLfloat* vertices, const GLfloat* textureCoordinates, int vertexCount) const;
+
     GLfloat Width() const { return m_width; };
     GLfloat Height() const { return m_height; };
     GLfloat PosX() const { return m_posX; };
     GLfloat PosY() const { return m_posY; };
+
+    // Texture coordinates of the top right corner, below 1 when the texture is padded.
+    GLfloat TextureWidth() const { return m_textureCoordinates[6]; };
+    GLfloat TextureHeight() const { return m_textureCoordinates[7]; };
 private:
     GLfloat m_vertices[8];
     GLfloat m_textureCoordinates[8];
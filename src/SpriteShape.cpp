@@ -0,0 +1,145 @@
+/*
+ * SpriteShape.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "SpriteShape.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+
+static const char Magic[4] = { 'H', 'S', 'H', 'P' };
+static const uint32 Version = 1;
+
+SpriteShape::SpriteShape()
+    : m_width(0)
+    , m_height(0)
+{
+}
+
+void SpriteShape::clear()
+{
+    m_vertices.clear();
+    m_firsts.clear();
+    m_counts.clear();
+}
+
+void SpriteShape::setSize(float width, float height)
+{
+    m_width = width;
+    m_height = height;
+}
+
+void SpriteShape::addPolygon(const HawkPoint* vertices, int count)
+{
+    ASSERT(count >= 3 && count <= b2_maxPolygonVertices);
+    m_firsts.push_back(m_vertices.size());
+    m_counts.push_back(count);
+    m_vertices.insert(m_vertices.end(), vertices, vertices + count);
+}
+
+const HawkPoint* SpriteShape::polygon(int index, int& count) const
+{
+    count = m_counts[index];
+    return &m_vertices[m_firsts[index]];
+}
+
+bool SpriteShape::load(const char* path)
+{
+    clear();
+
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+
+    char magic[4];
+    uint32 version, polygons;
+    float size[2];
+    bool ok = fread(magic, sizeof(magic), 1, file) == 1 && !memcmp(magic, Magic, sizeof(Magic))
+        && fread(&version, sizeof(version), 1, file) == 1 && version == Version
+        && fread(size, sizeof(size), 1, file) == 1
+        && fread(&polygons, sizeof(polygons), 1, file) == 1;
+
+    for (uint32 i = 0; ok && i < polygons; ++i) {
+        uint32 count;
+        float coordinates[2 * b2_maxPolygonVertices];
+        ok = fread(&count, sizeof(count), 1, file) == 1 && count >= 3 && count <= b2_maxPolygonVertices
+            && fread(coordinates, 2 * sizeof(float), count, file) == count;
+        if (!ok)
+            break;
+
+        HawkPoint vertices[b2_maxPolygonVertices];
+        for (uint32 v = 0; v < count; ++v)
+            vertices[v].Set(coordinates[2 * v], coordinates[2 * v + 1]);
+        addPolygon(vertices, count);
+    }
+    fclose(file);
+
+    if (!ok) {
+        fprintf(stderr, "Invalid shape file %s\n", path);
+        clear();
+        return false;
+    }
+    setSize(size[0], size[1]);
+    return true;
+}
+
+bool SpriteShape::save(const char* path) const
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+
+    uint32 polygons = m_counts.size();
+    float size[2] = { m_width, m_height };
+    bool ok = fwrite(Magic, sizeof(Magic), 1, file) == 1
+        && fwrite(&Version, sizeof(Version), 1, file) == 1
+        && fwrite(size, sizeof(size), 1, file) == 1
+        && fwrite(&polygons, sizeof(polygons), 1, file) == 1;
+
+    for (uint32 i = 0; ok && i < polygons; ++i) {
+        uint32 count = m_counts[i];
+        ok = fwrite(&count, sizeof(count), 1, file) == 1;
+        for (uint32 v = 0; ok && v < count; ++v) {
+            const HawkPoint& vertex = m_vertices[m_firsts[i] + v];
+            float coordinates[2] = { vertex.x, vertex.y };
+            ok = fwrite(coordinates, sizeof(coordinates), 1, file) == 1;
+        }
+    }
+
+    return fclose(file) == 0 && ok;
+}
+
+std::string SpriteShape::pathFor(const char* spritePath)
+{
+    std::string path(spritePath);
+    std::string::size_type dot = path.rfind('.');
+    std::string::size_type slash = path.rfind('/');
+    if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+        path.erase(dot);
+    return path + ".shape";
+}
+
+const SpriteShape* SpriteShape::forSprite(const char* spritePath)
+{
+    // Sprites without a shape are remembered too, so the file system is only asked once.
+    static std::map<std::string, SpriteShape*> s_shapes;
+    static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    pthread_mutex_lock(&s_mutex);
+    std::pair<std::map<std::string, SpriteShape*>::iterator, bool> entry = s_shapes.insert(std::make_pair(std::string(spritePath), static_cast<SpriteShape*>(0)));
+    if (entry.second) {
+        SpriteShape* shape = new SpriteShape;
+        if (shape->load(pathFor(spritePath).c_str()) && shape->polygonCount())
+            entry.first->second = shape;
+        else
+            delete shape;
+    }
+    const SpriteShape* shape = entry.first->second;
+    pthread_mutex_unlock(&s_mutex);
+    return shape;
+}
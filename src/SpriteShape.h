@@ -0,0 +1,61 @@
+/*
+ * SpriteShape.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef SPRITESHAPE_H_
+#define SPRITESHAPE_H_
+
+#include "HawkEngine.h"
+
+#include <string>
+#include <vector>
+
+class SpriteShape {
+public:
+    /**
+     * Convex polygons outlining the opaque part of a sprite, traced offline.
+     *
+     * tools/shapetracer writes a .shape file next to each PNG it traces; at run
+     * time the file is read straight into a table, so no image is decoded and
+     * nothing is traced on the device. Every polygon fits in b2_maxPolygonVertices.
+     *
+     * Vertices are in pixels relative to the centre of the sprite, y up.
+     *
+     * File layout, little endian: "HSHP", version, sprite width and height as
+     * floats, polygon count, then per polygon its vertex count and x, y floats.
+     */
+    SpriteShape();
+
+    bool load(const char* path);
+    bool save(const char* path) const;
+
+    void clear();
+    void setSize(float width, float height);
+    void addPolygon(const HawkPoint* vertices, int count);
+
+    int polygonCount() const { return m_counts.size(); }
+    const HawkPoint* polygon(int index, int& count) const;
+
+    float width() const { return m_width; }
+    float height() const { return m_height; }
+
+    // The .shape file for a sprite: the image path with its extension replaced.
+    static std::string pathFor(const char* spritePath);
+
+    /**
+     * The shape traced for a sprite, or 0 when none was. Each file is read once
+     * and kept for the life of the process; safe to call from several threads.
+     */
+    static const SpriteShape* forSprite(const char* spritePath);
+
+private:
+    float m_width;
+    float m_height;
+    std::vector<HawkPoint> m_vertices;
+    std::vector<int> m_firsts;
+    std::vector<int> m_counts;
+};
+
+#endif /* SPRITESHAPE_H_ */
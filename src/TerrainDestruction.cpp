@@ -0,0 +1,130 @@
+/*
+ * TerrainDestruction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "TerrainDestruction.h"
+
+#include <GLES/gl.h>
+#include <math.h>
+
+#include <algorithm>
+
+// Debris is thrown away from the centre of the hit at this speed, in m/s.
+static const float DebrisSpeed = 4.f;
+
+TerrainDestruction::TerrainDestruction()
+    : m_rowBudget(4)
+    , m_debrisLifetime(3.f)
+    , m_time(0)
+{
+}
+
+void TerrainDestruction::create(b2World* world, Sprite* debrisSprite, int debrisCount)
+{
+    DynamicHawkBodyDef def;
+    def.world = world;
+    def.speed = HawkVector(0, 0);
+    def.burst = HawkVector(0, 0);
+    def.fixedRotation = false;
+    def.categoryBits = DebrisCategory;
+
+    m_pool.create(def, debrisSprite, debrisCount);
+}
+
+void TerrainDestruction::add(DestructibleHawkBody* body)
+{
+    m_bodies.push_back(body);
+}
+
+int TerrainDestruction::explode(const HawkPoint& center, float radius)
+{
+    m_removed.clear();
+
+    int count = 0;
+    for (unsigned i = 0; i < m_bodies.size(); ++i) {
+        DestructibleHawkBody* body = m_bodies[i];
+        bool wasDirty = body->hasDirtyRows();
+        count += body->carve(center, radius, &m_removed);
+        if (!wasDirty && body->hasDirtyRows())
+            m_dirty.push_back(body);
+    }
+
+    // Spread the pieces evenly over the removed cells.
+    int pieces = std::min<int>(m_removed.size(), MaxDebrisPerExplosion);
+    for (int i = 0; i < pieces; ++i) {
+        const HawkPoint& position = m_removed[i * m_removed.size() / pieces];
+
+        DynamicHawkBody* piece = m_pool.acquire(position);
+        if (!piece && !m_debris.empty()) {
+            m_pool.release(m_debris.front().body);
+            m_debris.pop_front();
+            piece = m_pool.acquire(position);
+        }
+        if (!piece)
+            break;
+
+        HawkVector direction = position - center;
+        if (direction.Normalize() < b2_epsilon)
+            direction = HawkVector(0, 1);
+        piece->body()->SetLinearVelocity(DebrisSpeed * direction);
+
+        Debris debris = { piece, m_time + m_debrisLifetime };
+        m_debris.push_back(debris);
+    }
+    return count;
+}
+
+bool TerrainDestruction::update(float dt)
+{
+    m_time += dt;
+    while (!m_debris.empty() && m_debris.front().expires <= m_time) {
+        m_pool.release(m_debris.front().body);
+        m_debris.pop_front();
+    }
+
+    int budget = m_rowBudget;
+    while (budget > 0 && !m_dirty.empty()) {
+        DestructibleHawkBody* body = m_dirty.front();
+        budget -= body->rebuildDirtyRows(budget);
+        if (!body->hasDirtyRows())
+            m_dirty.pop_front();
+    }
+    return budget != m_rowBudget;
+}
+
+void TerrainDestruction::reset()
+{
+    m_pool.releaseAll();
+    m_debris.clear();
+    m_dirty.clear();
+    m_time = 0;
+
+    for (unsigned i = 0; i < m_bodies.size(); ++i) {
+        if (m_bodies[i]->filledCellCount() != m_bodies[i]->cellCount() || m_bodies[i]->hasDirtyRows())
+            m_bodies[i]->restore();
+    }
+}
+
+int TerrainDestruction::pendingRows() const
+{
+    int rows = 0;
+    for (unsigned i = 0; i < m_dirty.size(); ++i)
+        rows += m_dirty[i]->dirtyRowCount();
+    return rows;
+}
+
+void TerrainDestruction::draw()
+{
+    for (unsigned i = 0; i < m_debris.size(); ++i) {
+        b2Body* body = m_debris[i].body->body();
+
+        glPushMatrix();
+        HawkPoint position = Hawk::toPixels(body->GetPosition());
+        glTranslatef(position.x, position.y, 0);
+        glRotatef((180 * body->GetAngle() / M_PI), 0.0f, 0.0f, 1.0f);
+        m_debris[i].body->draw();
+        glPopMatrix();
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * TerrainDestruction.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef TERRAINDESTRUCTION_H_
+#define TERRAINDESTRUCTION_H_
+
+#include "BodyPool.h"
+#include "DestructibleHawkBody.h"
+
+#include <deque>
+#include <vector>
+
+class TerrainDestruction {
+public:
+    /**
+     * Breaks DestructibleHawkBody terrain and throws pooled debris out of the holes.
+     *
+     * explode() carves every registered body at once but only marks rows dirty;
+     * update() rebuilds at most the row budget per call across all bodies, so a
+     * large hit is spread over several frames. Debris pieces come from a BodyPool
+     * and go back to it when their lifetime runs out, or early when the pool is
+     * needed for a newer hit. Positions are in pixels.
+     */
+    TerrainDestruction();
+
+    void create(b2World*, Sprite* debrisSprite, int debrisCount);
+    void add(DestructibleHawkBody*);
+
+    void setRowBudget(int rows) { m_rowBudget = rows > 0 ? rows : 1; }
+    void setDebrisLifetime(float seconds) { m_debrisLifetime = seconds; }
+
+    // Carves every body within radius of center. Returns the number of cells removed.
+    int explode(const HawkPoint& center, float radius);
+
+    /**
+     * Rebuilds dirty rows within the budget and retires expired debris. Returns
+     * true when terrain fixtures changed, so anything holding fixture pointers to
+     * the terrain, such as a TerrainIndex, must be rebuilt.
+     */
+    bool update(float dt);
+
+    // Puts all terrain back together and returns every piece of debris.
+    void reset();
+
+    void draw();
+
+    int pendingRows() const;
+    int debrisCount() const { return m_debris.size(); }
+
+private:
+    enum { MaxDebrisPerExplosion = 12 };
+
+    struct Debris {
+        DynamicHawkBody* body;
+        float expires;
+    };
+
+    std::vector<DestructibleHawkBody*> m_bodies;
+
+    // Bodies with dirty rows, oldest hit first.
+    std::deque<DestructibleHawkBody*> m_dirty;
+
+    BodyPool m_pool;
+
+    // Oldest first. Every piece lives equally long, so this is also expiry order.
+    std::deque<Debris> m_debris;
+
+    std::vector<HawkPoint> m_removed;
+
+    int m_rowBudget;
+    float m_debrisLifetime;
+    float m_time;
+};
+
+#endif /* TERRAINDESTRUCTION_H_ */
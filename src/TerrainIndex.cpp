@@ -0,0 +1,216 @@
+/*
+ * TerrainIndex.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "TerrainIndex.h"
+
+#include <limits.h>
+
+static const int EmptyCell = 0x7fffffff;
+
+static unsigned hashCell(int x, int y)
+{
+    return static_cast<unsigned>(x) * 73856093u ^ static_cast<unsigned>(y) * 19349663u;
+}
+
+namespace {
+
+// Forwards tree results for static fixtures only. The tree matches against
+// fattened AABBs, so fixtures are tested again against their tight ones, as
+// the grid stores them.
+class StaticFilter : public b2QueryCallback {
+public:
+    StaticFilter(b2QueryCallback* callback, const b2AABB& aabb)
+        : m_callback(callback)
+        , m_aabb(aabb)
+    { }
+
+    virtual bool ReportFixture(b2Fixture* fixture)
+    {
+        if (fixture->GetBody()->GetType() != b2_staticBody)
+            return true;
+
+        for (int child = 0; child < fixture->GetShape()->GetChildCount(); ++child) {
+            if (b2TestOverlap(fixture->GetAABB(child), m_aabb))
+                return m_callback->ReportFixture(fixture);
+        }
+        return true;
+    }
+
+private:
+    b2QueryCallback* m_callback;
+    b2AABB m_aabb;
+};
+
+}
+
+TerrainIndex::TerrainIndex(Backend backend, float cellSize)
+    : m_backend(backend)
+    , m_cellSize(cellSize)
+    , m_inverseCellSize(1.f / cellSize)
+    , m_world(0)
+    , m_cellCount(0)
+    , m_minX(0)
+    , m_minY(0)
+    , m_maxX(-1)
+    , m_maxY(-1)
+    , m_queryStamp(0)
+{
+}
+
+void TerrainIndex::clear()
+{
+    m_world = 0;
+    m_cells.clear();
+    m_cellCount = 0;
+    m_cellEntries.clear();
+    m_fixtures.clear();
+    m_queryStamps.clear();
+    m_minX = m_minY = 0;
+    m_maxX = m_maxY = -1;
+}
+
+int TerrainIndex::findCell(int x, int y) const
+{
+    if (m_cells.empty())
+        return -1;
+
+    const unsigned mask = m_cells.size() - 1;
+    for (unsigned i = hashCell(x, y) & mask; ; i = (i + 1) & mask) {
+        const Cell& cell = m_cells[i];
+        if (cell.x == EmptyCell)
+            return -1;
+        if (cell.x == x && cell.y == y)
+            return i;
+    }
+}
+
+int TerrainIndex::insertCell(int x, int y)
+{
+    const unsigned mask = m_cells.size() - 1;
+    unsigned i = hashCell(x, y) & mask;
+    for (; m_cells[i].x != EmptyCell; i = (i + 1) & mask) {
+        if (m_cells[i].x == x && m_cells[i].y == y)
+            return i;
+    }
+
+    m_cells[i].x = x;
+    m_cells[i].y = y;
+    m_cells[i].first = 0;
+    m_cells[i].count = 0;
+    ++m_cellCount;
+    return i;
+}
+
+void TerrainIndex::build(b2World* world)
+{
+    clear();
+    m_world = world;
+    if (m_backend != GridBackend)
+        return;
+
+    m_minX = m_minY = INT_MAX;
+    m_maxX = m_maxY = INT_MIN;
+
+    int cellReferences = 0;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        if (body->GetType() != b2_staticBody || !body->IsActive())
+            continue;
+
+        for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext()) {
+            for (int child = 0; child < fixture->GetShape()->GetChildCount(); ++child) {
+                Entry entry;
+                entry.fixture = fixture;
+                entry.aabb = fixture->GetAABB(child);
+                m_fixtures.push_back(entry);
+
+                m_minX = b2Min(m_minX, cellCoordinate(entry.aabb.lowerBound.x));
+                m_minY = b2Min(m_minY, cellCoordinate(entry.aabb.lowerBound.y));
+                m_maxX = b2Max(m_maxX, cellCoordinate(entry.aabb.upperBound.x));
+                m_maxY = b2Max(m_maxY, cellCoordinate(entry.aabb.upperBound.y));
+
+                cellReferences += (cellCoordinate(entry.aabb.upperBound.x) - cellCoordinate(entry.aabb.lowerBound.x) + 1)
+                    * (cellCoordinate(entry.aabb.upperBound.y) - cellCoordinate(entry.aabb.lowerBound.y) + 1);
+            }
+        }
+    }
+
+    // Keep the table at most half full.
+    unsigned tableSize = 16;
+    while (tableSize < static_cast<unsigned>(cellReferences) * 2)
+        tableSize *= 2;
+    Cell empty = { EmptyCell, EmptyCell, 0, 0 };
+    m_cells.assign(tableSize, empty);
+
+    // Count the fixtures per cell, lay the cells out back to back, then fill them.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (unsigned i = 0; i < m_fixtures.size(); ++i) {
+            const b2AABB& aabb = m_fixtures[i].aabb;
+            for (int y = cellCoordinate(aabb.lowerBound.y); y <= cellCoordinate(aabb.upperBound.y); ++y) {
+                for (int x = cellCoordinate(aabb.lowerBound.x); x <= cellCoordinate(aabb.upperBound.x); ++x) {
+                    Cell& cell = m_cells[pass ? findCell(x, y) : insertCell(x, y)];
+                    if (pass)
+                        m_cellEntries[cell.first + cell.count] = i;
+                    ++cell.count;
+                }
+            }
+        }
+
+        if (!pass) {
+            int first = 0;
+            for (unsigned i = 0; i < m_cells.size(); ++i) {
+                m_cells[i].first = first;
+                first += m_cells[i].count;
+                m_cells[i].count = 0;
+            }
+            m_cellEntries.resize(first);
+        }
+    }
+
+    m_queryStamps.assign(m_fixtures.size(), 0);
+}
+
+void TerrainIndex::query(b2QueryCallback* callback, const b2AABB& aabb) const
+{
+    if (m_backend == TreeBackend) {
+        if (m_world) {
+            StaticFilter filter(callback, aabb);
+            m_world->QueryAABB(&filter, aabb);
+        }
+        return;
+    }
+
+    if (m_cells.empty())
+        return;
+
+    if (!++m_queryStamp) {
+        m_queryStamps.assign(m_queryStamps.size(), 0);
+        m_queryStamp = 1;
+    }
+
+    int minX = b2Max(m_minX, cellCoordinate(aabb.lowerBound.x));
+    int minY = b2Max(m_minY, cellCoordinate(aabb.lowerBound.y));
+    int maxX = b2Min(m_maxX, cellCoordinate(aabb.upperBound.x));
+    int maxY = b2Min(m_maxY, cellCoordinate(aabb.upperBound.y));
+
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            int index = findCell(x, y);
+            if (index < 0)
+                continue;
+
+            const Cell& cell = m_cells[index];
+            for (int i = cell.first; i < cell.first + cell.count; ++i) {
+                int entry = m_cellEntries[i];
+                if (m_queryStamps[entry] == m_queryStamp)
+                    continue;
+                m_queryStamps[entry] = m_queryStamp;
+
+                if (b2TestOverlap(m_fixtures[entry].aabb, aabb) && !callback->ReportFixture(m_fixtures[entry].fixture))
+                    return;
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * TerrainIndex.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef TERRAININDEX_H_
+#define TERRAININDEX_H_
+
+#include "HawkEngine.h"
+
+#include <vector>
+
+class TerrainIndex {
+public:
+    /**
+     * Answers AABB queries against the static fixtures of a world.
+     *
+     * TreeBackend forwards to b2World::QueryAABB and skips non-static fixtures.
+     * GridBackend buckets the static fixtures into a uniform spatial hash once,
+     * which suits tile levels of many same-sized pieces: a query only visits the
+     * few cells it overlaps and never sees dynamic bodies.
+     *
+     * The grid is a snapshot; call build() again after static fixtures change.
+     *
+     * This is a query helper for game code only. b2World finds contact pairs in
+     * its own broad-phase, which WorldSettings::broadPhaseCellSize can put on a
+     * grid of its own.
+     */
+    enum Backend {
+        TreeBackend,
+        GridBackend,
+    };
+
+    TerrainIndex(Backend = GridBackend, float cellSize = 2.0f);
+
+    Backend backend() const { return m_backend; }
+
+    void build(b2World*);
+    void clear();
+
+    // Reports each overlapping static fixture once. Stops when the callback returns false.
+    void query(b2QueryCallback*, const b2AABB&) const;
+
+    int fixtureCount() const { return m_fixtures.size(); }
+    int cellCount() const { return m_cellCount; }
+
+private:
+    struct Cell {
+        int x;
+        int y;
+        int first;
+        int count;
+    };
+
+    struct Entry {
+        b2Fixture* fixture;
+        b2AABB aabb;
+    };
+
+    int cellCoordinate(float value) const { return static_cast<int>(floorf(value * m_inverseCellSize)); }
+    int findCell(int x, int y) const;
+    int insertCell(int x, int y);
+
+    Backend m_backend;
+    float m_cellSize;
+    float m_inverseCellSize;
+
+    b2World* m_world;
+
+    // Open-addressed table of occupied cells; each names a run of m_cellEntries.
+    std::vector<Cell> m_cells;
+    int m_cellCount;
+    std::vector<int> m_cellEntries;
+    std::vector<Entry> m_fixtures;
+
+    // Occupied cell range, so large queries skip empty space.
+    int m_minX, m_minY, m_maxX, m_maxY;
+
+    // Per-fixture stamp so fixtures spanning several cells are reported once.
+    mutable std::vector<unsigned> m_queryStamps;
+    mutable unsigned m_queryStamp;
+};
+
+#endif /* TERRAININDEX_H_ */
@@ -0,0 +1,160 @@
+/*
+ * VoicePool.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "VoicePool.h"
+
+#include <stdio.h>
+#include <time.h>
+
+static double now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+VoicePool::VoicePool()
+    : m_repeatWindow(0.05f)
+    , m_stolen(0)
+    , m_dropped(0)
+{
+}
+
+VoicePool::~VoicePool()
+{
+    destroy();
+}
+
+bool VoicePool::create(int voiceCount)
+{
+    destroy();
+    if (voiceCount <= 0)
+        return false;
+
+    std::vector<ALuint> sources(voiceCount);
+
+    // Clear old AL error
+    alGetError();
+    alGenSources(voiceCount, &sources[0]);
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot generate %d effect sources: %d\n", voiceCount, error);
+        return false;
+    }
+
+    m_voices.resize(voiceCount);
+    for (int i = 0; i < voiceCount; ++i) {
+        Voice voice = { sources[i], 0, 0, 0, 0 };
+        m_voices[i] = voice;
+    }
+    return true;
+}
+
+void VoicePool::destroy()
+{
+    stopAll();
+    for (unsigned i = 0; i < m_voices.size(); ++i)
+        alDeleteSources(1, &m_voices[i].source);
+    m_voices.clear();
+}
+
+bool VoicePool::isPlaying(const Voice& voice) const
+{
+    if (!voice.buffer)
+        return false;
+    ALint state;
+    alGetSourcei(voice.source, AL_SOURCE_STATE, &state);
+    return state == AL_PLAYING || state == AL_PAUSED;
+}
+
+VoicePool::Voice* VoicePool::findVoice(int priority)
+{
+    Voice* victim = 0;
+    for (unsigned i = 0; i < m_voices.size(); ++i) {
+        Voice& voice = m_voices[i];
+        if (!isPlaying(voice))
+            return &voice;
+
+        if (voice.priority > priority)
+            continue;
+        if (!victim || voice.priority < victim->priority
+            || (voice.priority == victim->priority && (voice.gain < victim->gain
+                || (voice.gain == victim->gain && voice.started < victim->started))))
+            victim = &voice;
+    }
+
+    if (victim) {
+        alSourceStop(victim->source);
+        ++m_stolen;
+    }
+    return victim;
+}
+
+bool VoicePool::play(ALuint buffer, int priority, float gain)
+{
+    if (!buffer || m_voices.empty())
+        return false;
+
+    double time = now();
+    for (unsigned i = 0; i < m_voices.size(); ++i) {
+        Voice& voice = m_voices[i];
+        if (voice.buffer != buffer || time - voice.started >= m_repeatWindow || !isPlaying(voice))
+            continue;
+
+        if (gain > voice.gain) {
+            voice.gain = gain;
+            alSourcef(voice.source, AL_GAIN, gain);
+        }
+        ++m_dropped;
+        return false;
+    }
+
+    Voice* voice = findVoice(priority);
+    if (!voice) {
+        ++m_dropped;
+        return false;
+    }
+
+    // Clear old AL error
+    alGetError();
+    alSourcei(voice->source, AL_BUFFER, buffer);
+    alSourcef(voice->source, AL_GAIN, gain);
+    alSourcePlay(voice->source);
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fprintf(stderr, "Cannot play effect: %d\n", error);
+        voice->buffer = 0;
+        return false;
+    }
+
+    voice->buffer = buffer;
+    voice->priority = priority;
+    voice->gain = gain;
+    voice->started = time;
+    return true;
+}
+
+void VoicePool::stop(ALuint buffer)
+{
+    for (unsigned i = 0; i < m_voices.size(); ++i) {
+        Voice& voice = m_voices[i];
+        if (voice.buffer != buffer)
+            continue;
+        alSourceStop(voice.source);
+        alSourcei(voice.source, AL_BUFFER, 0);
+        voice.buffer = 0;
+    }
+}
+
+void VoicePool::stopAll()
+{
+    for (unsigned i = 0; i < m_voices.size(); ++i) {
+        Voice& voice = m_voices[i];
+        alSourceStop(voice.source);
+        alSourcei(voice.source, AL_BUFFER, 0);
+        voice.buffer = 0;
+    }
+}
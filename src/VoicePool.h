@@ -0,0 +1,63 @@
+/*
+ * VoicePool.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef VOICEPOOL_H_
+#define VOICEPOOL_H_
+
+#include <AL/al.h>
+
+#include <vector>
+
+class VoicePool {
+public:
+    /**
+     * A fixed set of AL sources shared by all short sound effects.
+     *
+     * play() binds a buffer to an idle source. When every source is busy, the
+     * voice with the lowest priority, then the quietest, then the oldest is stolen,
+     * but never one with a higher priority than the request. A buffer started
+     * again within the repeat window does not get a second voice; the voice
+     * already playing it is raised to the louder gain instead. However many
+     * contacts fire, the source count and the AL calls per play stay bounded.
+     */
+    VoicePool();
+    ~VoicePool();
+
+    bool create(int voiceCount);
+    void destroy();
+
+    void setRepeatWindow(float seconds) { m_repeatWindow = seconds; }
+
+    // Returns false when the request was merged into a recent voice or nothing could be stolen.
+    bool play(ALuint buffer, int priority, float gain);
+
+    // Stops every voice playing buffer, so it can be deleted.
+    void stop(ALuint buffer);
+    void stopAll();
+
+    int voiceCount() const { return m_voices.size(); }
+    int stolenCount() const { return m_stolen; }
+    int droppedCount() const { return m_dropped; }
+
+private:
+    struct Voice {
+        ALuint source;
+        ALuint buffer;
+        int priority;
+        float gain;
+        double started;
+    };
+
+    bool isPlaying(const Voice&) const;
+    Voice* findVoice(int priority);
+
+    std::vector<Voice> m_voices;
+    float m_repeatWindow;
+    int m_stolen;
+    int m_dropped;
+};
+
+#endif /* VOICEPOOL_H_ */
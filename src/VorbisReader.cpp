@@ -0,0 +1,83 @@
+/*
+ * VorbisReader.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "VorbisReader.h"
+
+#include <stdio.h>
+
+VorbisReader::VorbisReader()
+    : m_open(false)
+    , m_format(0)
+    , m_frequency(0)
+    , m_frameSize(0)
+{
+}
+
+VorbisReader::~VorbisReader()
+{
+    close();
+}
+
+bool VorbisReader::open(const char* fileName)
+{
+    close();
+
+    if (ov_fopen(fileName, &m_file)) {
+        fprintf(stderr, "%s is not an Ogg Vorbis file\n", fileName);
+        return false;
+    }
+    m_open = true;
+
+    vorbis_info* info = ov_info(&m_file, -1);
+    if (!info || info->channels < 1 || info->channels > 2) {
+        fprintf(stderr, "%s: only mono or stereo Vorbis is supported\n", fileName);
+        close();
+        return false;
+    }
+
+    m_format = info->channels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    m_frequency = info->rate;
+    m_frameSize = 2 * info->channels;
+    return true;
+}
+
+void VorbisReader::close()
+{
+    if (m_open)
+        ov_clear(&m_file);
+    m_open = false;
+}
+
+int VorbisReader::read(void* buffer, int size)
+{
+    if (!m_open)
+        return -1;
+
+    // ov_read() returns at most one packet, so keep going until the buffer is full.
+    char* out = static_cast<char*>(buffer);
+    int wanted = size - size % m_frameSize;
+    int filled = 0;
+    while (filled < wanted) {
+        int section;
+        long count = ov_read(&m_file, out + filled, wanted - filled, 0, 2, 1, &section);
+        if (count == 0)
+            break;
+        // A hole is a gap in the stream, not a failure; decoding carries on after it.
+        if (count == OV_HOLE)
+            continue;
+        if (count < 0) {
+            fprintf(stderr, "Cannot decode Vorbis data: %ld\n", count);
+            return -1;
+        }
+        filled += count;
+    }
+    return filled;
+}
+
+bool VorbisReader::rewind()
+{
+    return m_open && ov_pcm_seek(&m_file, 0) == 0;
+}
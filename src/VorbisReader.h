@@ -0,0 +1,43 @@
+/*
+ * VorbisReader.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef VORBISREADER_H_
+#define VORBISREADER_H_
+
+#include "AudioDecoder.h"
+
+#include <vorbis/vorbisfile.h>
+
+class VorbisReader : public AudioDecoder {
+public:
+    /**
+     * Decodes an Ogg Vorbis file through vorbisfile into 16 bit mono or stereo PCM.
+     *
+     * Decoding happens in read(), so a streamed track only ever costs the
+     * decoder state and the buffer being filled.
+     */
+    VorbisReader();
+    virtual ~VorbisReader();
+
+    virtual bool open(const char* fileName);
+    virtual void close();
+    virtual bool isOpen() const { return m_open; }
+
+    virtual ALenum format() const { return m_format; }
+    virtual ALsizei frequency() const { return m_frequency; }
+
+    virtual int read(void* buffer, int size);
+    virtual bool rewind();
+
+private:
+    OggVorbis_File m_file;
+    bool m_open;
+    ALenum m_format;
+    ALsizei m_frequency;
+    int m_frameSize;
+};
+
+#endif /* VORBISREADER_H_ */
@@ -0,0 +1,135 @@
+/*
+ * WavReader.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "WavReader.h"
+
+#include <string.h>
+
+static unsigned readLE16(const unsigned char* p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned readLE32(const unsigned char* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<unsigned>(p[3]) << 24);
+}
+
+WavReader::WavReader()
+    : m_file(0)
+    , m_format(0)
+    , m_frequency(0)
+    , m_frameSize(0)
+    , m_dataStart(0)
+    , m_dataSize(0)
+    , m_position(0)
+{
+}
+
+WavReader::~WavReader()
+{
+    close();
+}
+
+bool WavReader::open(const char* fileName)
+{
+    close();
+
+    m_file = fopen(fileName, "rb");
+    if (!m_file) {
+        fprintf(stderr, "Cannot open %s\n", fileName);
+        return false;
+    }
+
+    unsigned char header[12];
+    if (fread(header, 1, sizeof(header), m_file) != sizeof(header) || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        fprintf(stderr, "%s is not a WAV file\n", fileName);
+        close();
+        return false;
+    }
+
+    bool haveFormat = false;
+    unsigned char chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), m_file) == sizeof(chunk)) {
+        unsigned size = readLE32(chunk + 4);
+
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            unsigned char format[16];
+            if (fread(format, 1, sizeof(format), m_file) != sizeof(format))
+                break;
+            unsigned encoding = readLE16(format);
+            unsigned channels = readLE16(format + 2);
+            unsigned bits = readLE16(format + 14);
+            if (encoding != 1 || channels < 1 || channels > 2 || (bits != 8 && bits != 16)) {
+                fprintf(stderr, "%s: only 8 and 16 bit mono or stereo PCM is supported\n", fileName);
+                close();
+                return false;
+            }
+
+            m_frequency = readLE32(format + 4);
+            m_frameSize = channels * bits / 8;
+            if (channels == 1)
+                m_format = bits == 8 ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
+            else
+                m_format = bits == 8 ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
+            haveFormat = true;
+            size -= sizeof(format);
+        } else if (!memcmp(chunk, "data", 4) && haveFormat) {
+            m_dataStart = ftell(m_file);
+            m_dataSize = size - size % m_frameSize;
+            m_position = 0;
+            return true;
+        }
+
+        // Chunks are padded to an even size.
+        if (fseek(m_file, size + (size & 1), SEEK_CUR))
+            break;
+    }
+
+    fprintf(stderr, "%s has no PCM data\n", fileName);
+    close();
+    return false;
+}
+
+void WavReader::close()
+{
+    if (m_file)
+        fclose(m_file);
+    m_file = 0;
+    m_dataSize = 0;
+    m_position = 0;
+}
+
+int WavReader::read(void* buffer, int size)
+{
+    if (!m_file || !m_frameSize)
+        return -1;
+
+    long left = m_dataSize - m_position;
+    long wanted = size < left ? size : left;
+    wanted -= wanted % m_frameSize;
+    if (wanted <= 0)
+        return 0;
+
+    size_t count = fread(buffer, 1, wanted, m_file);
+    if (count != static_cast<size_t>(wanted) && ferror(m_file))
+        return -1;
+
+    // A truncated file ends early; keep the position on a frame boundary.
+    count -= count % m_frameSize;
+    m_position += count;
+    if (count < static_cast<size_t>(wanted))
+        m_dataSize = m_position;
+    return count;
+}
+
+bool WavReader::rewind()
+{
+    if (!m_file || fseek(m_file, m_dataStart, SEEK_SET))
+        return false;
+    m_position = 0;
+    return true;
+}
@@ -0,0 +1,50 @@
+/*
+ * WavReader.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef WAVREADER_H_
+#define WAVREADER_H_
+
+#include "AudioDecoder.h"
+
+#include <stdio.h>
+
+class WavReader : public AudioDecoder {
+public:
+    /**
+     * Reads the PCM data of a RIFF/WAV file a piece at a time.
+     *
+     * open() walks the chunk list once to find the format and the data chunk;
+     * after that read() only copies samples from the file, so a long track can be
+     * streamed through a few small buffers instead of being loaded whole.
+     * 8 and 16 bit mono and stereo PCM are supported, which is what OpenAL plays.
+     */
+    WavReader();
+    virtual ~WavReader();
+
+    virtual bool open(const char* fileName);
+    virtual void close();
+    virtual bool isOpen() const { return m_file != 0; }
+
+    virtual ALenum format() const { return m_format; }
+    virtual ALsizei frequency() const { return m_frequency; }
+
+    // Size of the PCM data in bytes.
+    long dataSize() const { return m_dataSize; }
+
+    virtual int read(void* buffer, int size);
+    virtual bool rewind();
+
+private:
+    FILE* m_file;
+    ALenum m_format;
+    ALsizei m_frequency;
+    int m_frameSize;
+    long m_dataStart;
+    long m_dataSize;
+    long m_position;
+};
+
+#endif /* WAVREADER_H_ */
@@ -0,0 +1,90 @@
+/*
+ * WorldChecksum.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "WorldChecksum.h"
+
+#include <string.h>
+
+static const uint64_t FnvOffsetBasis = 14695981039346656037ULL;
+static const uint64_t FnvPrime = 1099511628211ULL;
+
+// FNV-1a over the bit pattern, so -0.0f and 0.0f or different NaNs also differ.
+static inline uint64_t mix(uint64_t hash, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; ++i, bits >>= 8)
+        hash = (hash ^ (bits & 0xff)) * FnvPrime;
+    return hash;
+}
+
+WorldChecksum::WorldChecksum()
+    : m_steps(0)
+    , m_log(0)
+{
+    memset(m_history, 0, sizeof(m_history));
+}
+
+WorldChecksum::~WorldChecksum()
+{
+    closeLog();
+}
+
+bool WorldChecksum::openLog(const char* path)
+{
+    closeLog();
+
+    m_log = fopen(path, "w");
+    if (!m_log) {
+        fprintf(stderr, "Cannot open checksum log %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+void WorldChecksum::closeLog()
+{
+    if (m_log)
+        fclose(m_log);
+    m_log = 0;
+}
+
+uint64_t WorldChecksum::compute(const b2World* world)
+{
+    uint64_t hash = FnvOffsetBasis;
+    for (const b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        const b2Vec2& position = body->GetPosition();
+        const b2Vec2& velocity = body->GetLinearVelocity();
+        hash = mix(hash, position.x);
+        hash = mix(hash, position.y);
+        hash = mix(hash, body->GetAngle());
+        hash = mix(hash, velocity.x);
+        hash = mix(hash, velocity.y);
+        hash = mix(hash, body->GetAngularVelocity());
+    }
+    return hash;
+}
+
+uint64_t WorldChecksum::record(const b2World* world)
+{
+    uint64_t hash = compute(world);
+    m_history[m_steps % HistorySize] = hash;
+
+    if (m_log)
+        fprintf(m_log, "%u %016llx\n", m_steps, static_cast<unsigned long long>(hash));
+
+    ++m_steps;
+    return hash;
+}
+
+bool WorldChecksum::lookup(unsigned step, uint64_t& hash) const
+{
+    if (step >= m_steps || m_steps - step > HistorySize)
+        return false;
+
+    hash = m_history[step % HistorySize];
+    return true;
+}
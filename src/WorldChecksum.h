@@ -0,0 +1,50 @@
+/*
+ * WorldChecksum.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef WORLDCHECKSUM_H_
+#define WORLDCHECKSUM_H_
+
+#include "HawkEngine.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+class WorldChecksum {
+public:
+    /**
+     * Hashes the exact bits of every body's position, angle and velocities after
+     * each step, so two runs can be compared for bit-exact determinism.
+     *
+     * The most recent HistorySize hashes are kept in a ring buffer. If a log is
+     * open every hash is also written to it as "<step> <hash>" lines, which the
+     * checksumdiff tool compares.
+     */
+    WorldChecksum();
+    ~WorldChecksum();
+
+    enum { HistorySize = 256 };
+
+    bool openLog(const char* path);
+    void closeLog();
+
+    // Hashes the world as it is now and records it as the next step.
+    uint64_t record(const b2World*);
+
+    static uint64_t compute(const b2World*);
+
+    // Number of steps recorded so far.
+    unsigned steps() const { return m_steps; }
+
+    // Hash of an earlier step; false once it has left the ring buffer.
+    bool lookup(unsigned step, uint64_t& hash) const;
+
+private:
+    uint64_t m_history[HistorySize];
+    unsigned m_steps;
+    FILE* m_log;
+};
+
+#endif /* WORLDCHECKSUM_H_ */
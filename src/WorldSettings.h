@@ -0,0 +1,77 @@
+/*
+ * WorldSettings.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef WORLDSETTINGS_H_
+#define WORLDSETTINGS_H_
+
+#include "HawkEngine.h"
+#include "TerrainIndex.h"
+
+// How a b2World is created and stepped. GameLogic and the tools share the
+// defaults so measurements match the game.
+struct WorldSettings {
+    WorldSettings()
+        : gravity(0.0f, -10.0f)
+        , timeStep(1.0f / 60.0f)
+        , velocityIterations(6)
+        , positionIterations(2)
+        , allowSleeping(true)
+        , warmStarting(true)
+        , continuousPhysics(true)
+        , islandThreads(1)
+        , batchContacts(false)
+        , broadPhaseCellSize(0.0f)
+        , terrainBackend(TerrainIndex::GridBackend)
+        , terrainCellSize(2.0f)
+    { }
+
+    HawkVector gravity;
+    float timeStep;
+    int velocityIterations;
+    int positionIterations;
+
+    // Sleeping bodies drop out of island solving entirely.
+    bool allowSleeping;
+    // Reusing last step's impulses lets the solver converge in fewer iterations.
+    bool warmStarting;
+    // Time of impact sub-steps for fast bodies, the costliest part of a busy step.
+    bool continuousPhysics;
+    // Threads that independent islands are solved on, the stepping thread
+    // included. Needs Box2D built with Res/Box2D_patches; ignored otherwise.
+    int islandThreads;
+    // Solve contact velocities four at a time with SIMD. Slightly different
+    // results from the sequential solver; same patch requirement.
+    bool batchContacts;
+    // Find new contact pairs on a uniform grid of cells this wide instead of
+    // the dynamic tree when positive. Same pairs, same results; same patch
+    // requirement.
+    float broadPhaseCellSize;
+
+    // How game code queries static terrain; see TerrainIndex.
+    TerrainIndex::Backend terrainBackend;
+    float terrainCellSize;
+
+    void apply(b2World* world) const
+    {
+        world->SetGravity(gravity);
+        world->SetAllowSleeping(allowSleeping);
+        world->SetWarmStarting(warmStarting);
+        world->SetContinuousPhysics(continuousPhysics);
+#ifdef B2_PARALLEL_ISLANDS
+        world->SetIslandThreads(islandThreads);
+#endif
+#ifdef B2_CONTACT_BATCHING
+        world->SetContactBatching(batchContacts);
+#endif
+#ifdef B2_GRID_BROADPHASE
+        world->SetBroadPhaseCellSize(broadPhaseCellSize);
+#endif
+    }
+
+    void step(b2World* world) const { world->Step(timeStep, velocityIterations, positionIterations); }
+};
+
+#endif /* WORLDSETTINGS_H_ */
@@ -0,0 +1,188 @@
+/*
+ * WorldSnapshot.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "WorldSnapshot.h"
+
+#include "ActorController.h"
+#include "HawkBody.h"
+
+#include <string.h>
+
+namespace {
+
+struct Header {
+    uint32 bodyCount;
+    uint32 actorCount;
+};
+
+enum {
+    Awake = 1 << 0,
+    Active = 1 << 1,
+};
+
+struct BodyState {
+    // Position in b2World::GetBodyList(), static bodies included.
+    uint32 index;
+    float32 x;
+    float32 y;
+    float32 angle;
+    float32 linearX;
+    float32 linearY;
+    float32 angular;
+    float32 sleepTime;
+    uint8 flags;
+    uint8 horizontal;
+    uint8 vertical;
+};
+
+struct ActorState {
+    uint8 horizontal;
+    uint8 vertical;
+};
+
+}
+
+static size_t bufferSize(int bodies, int actors)
+{
+    return sizeof(Header) + bodies * sizeof(BodyState) + actors * sizeof(ActorState);
+}
+
+WorldSnapshot::WorldSnapshot()
+{
+}
+
+void WorldSnapshot::reserve(int bodies, int actors)
+{
+    m_buffer.reserve(bufferSize(bodies, actors));
+}
+
+void WorldSnapshot::capture(b2World* world, const ActorController* actors)
+{
+    Header header;
+    header.bodyCount = 0;
+    header.actorCount = actors ? actors->size() : 0;
+
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext())
+        header.bodyCount += body->GetType() != b2_staticBody;
+
+    m_buffer.resize(bufferSize(header.bodyCount, header.actorCount));
+    memcpy(&m_buffer[0], &header, sizeof(header));
+
+    BodyState* state = reinterpret_cast<BodyState*>(&m_buffer[sizeof(Header)]);
+    uint32 index = 0;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext(), ++index) {
+        if (body->GetType() == b2_staticBody)
+            continue;
+
+        const b2Vec2& position = body->GetPosition();
+        const b2Vec2& velocity = body->GetLinearVelocity();
+        state->index = index;
+        state->x = position.x;
+        state->y = position.y;
+        state->angle = body->GetAngle();
+        state->linearX = velocity.x;
+        state->linearY = velocity.y;
+        state->angular = body->GetAngularVelocity();
+#ifdef B2_BODY_SLEEP_TIME
+        state->sleepTime = body->GetSleepTime();
+#else
+        state->sleepTime = 0;
+#endif
+        state->flags = (body->IsAwake() ? Awake : 0) | (body->IsActive() ? Active : 0);
+        state->horizontal = state->vertical = DynamicHawkBody::Coast;
+
+        HawkBody* hawkBody = static_cast<HawkBody*>(body->GetUserData());
+        if (DynamicHawkBody* dynamic = hawkBody ? hawkBody->toDynamic() : 0) {
+            state->horizontal = dynamic->horizontalMovement();
+            state->vertical = dynamic->verticalMovement();
+        }
+        ++state;
+    }
+
+    ActorState* actor = reinterpret_cast<ActorState*>(state);
+    for (uint32 i = 0; i < header.actorCount; ++i, ++actor) {
+        actor->horizontal = actors->horizontalMovement(i);
+        actor->vertical = actors->verticalMovement(i);
+    }
+}
+
+bool WorldSnapshot::restore(b2World* world, ActorController* actors) const
+{
+    if (m_buffer.empty())
+        return false;
+
+    Header header;
+    memcpy(&header, &m_buffer[0], sizeof(header));
+    if (actors && static_cast<uint32>(actors->size()) != header.actorCount)
+        return false;
+
+    // Verify the world still holds the captured bodies in the same places before
+    // touching any.
+    const BodyState* first = reinterpret_cast<const BodyState*>(&m_buffer[sizeof(Header)]);
+    const BodyState* state = first;
+    const BodyState* end = first + header.bodyCount;
+    uint32 index = 0;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext(), ++index) {
+        if (body->GetType() == b2_staticBody)
+            continue;
+        if (state == end || state->index != index)
+            return false;
+        ++state;
+    }
+    if (state != end)
+        return false;
+
+    state = first;
+    index = 0;
+    for (b2Body* body = world->GetBodyList(); state != end; body = body->GetNext(), ++index) {
+        if (state->index != index)
+            continue;
+
+        body->SetActive(state->flags & Active);
+        body->SetTransform(b2Vec2(state->x, state->y), state->angle);
+        // Putting a body to sleep clears its velocity, so wake state comes first.
+        body->SetAwake(state->flags & Awake);
+        body->SetLinearVelocity(b2Vec2(state->linearX, state->linearY));
+        body->SetAngularVelocity(state->angular);
+        // Last, as waking a body zeroes its sleep time.
+#ifdef B2_BODY_SLEEP_TIME
+        body->SetSleepTime(state->sleepTime);
+#endif
+
+        HawkBody* hawkBody = static_cast<HawkBody*>(body->GetUserData());
+        if (DynamicHawkBody* dynamic = hawkBody ? hawkBody->toDynamic() : 0) {
+            dynamic->setHorizontalMovement(static_cast<DynamicHawkBody::Movement>(state->horizontal));
+            dynamic->setVerticalMovement(static_cast<DynamicHawkBody::Movement>(state->vertical));
+        }
+        ++state;
+    }
+    world->ClearForces();
+
+    if (actors) {
+        const ActorState* actor = reinterpret_cast<const ActorState*>(end);
+        for (uint32 i = 0; i < header.actorCount; ++i, ++actor) {
+            actors->setHorizontalMovement(i, static_cast<DynamicHawkBody::Movement>(actor->horizontal));
+            actors->setVerticalMovement(i, static_cast<DynamicHawkBody::Movement>(actor->vertical));
+        }
+    }
+
+    return true;
+}
+
+bool WorldSnapshot::load(const unsigned char* data, size_t size)
+{
+    m_buffer.clear();
+
+    Header header;
+    if (size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (size != bufferSize(header.bodyCount, header.actorCount))
+        return false;
+
+    m_buffer.assign(data, data + size);
+    return true;
+}
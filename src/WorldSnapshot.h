@@ -0,0 +1,61 @@
+/*
+ * WorldSnapshot.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef WORLDSNAPSHOT_H_
+#define WORLDSNAPSHOT_H_
+
+#include "HawkEngine.h"
+
+#include <vector>
+
+class ActorController;
+
+class WorldSnapshot {
+public:
+    /**
+     * The dynamic state of a b2World in a compact binary buffer.
+     *
+     * capture() records transforms, velocities, awake/active flags, sleep time and
+     * the movement of every non-static body, plus an ActorController's movement if
+     * given. restore() writes that state back onto the same bodies in place;
+     * nothing is created or destroyed. Static bodies never move and are skipped.
+     *
+     * Bodies are named by their position in the world's body list, so a saved
+     * buffer can be load()ed into a world built the same way, such as the same
+     * level loaded again.
+     *
+     * Contacts are not captured. After a restore the next step warm starts from
+     * the contacts the world holds, or none in a freshly built world, so a restored
+     * run drifts from the original one; restored stacks start cold and can take a
+     * while to settle again. Sleep time needs Box2D built with Res/Box2D_patches;
+     * without it restored bodies start resting from zero.
+     *
+     * The buffer is reused between captures, so after reserve() or the first
+     * capture, capturing the same world again does not allocate.
+     */
+    WorldSnapshot();
+
+    void reserve(int bodies, int actors = 0);
+
+    void capture(b2World*, const ActorController* = 0);
+
+    // Returns false, leaving the world untouched, if bodies were created or
+    // destroyed since the capture.
+    bool restore(b2World*, ActorController* = 0) const;
+
+    // Takes a buffer saved from data(). Returns false, leaving the snapshot
+    // empty, if the bytes are not a snapshot.
+    bool load(const unsigned char* data, size_t size);
+
+    bool isEmpty() const { return m_buffer.empty(); }
+    size_t byteSize() const { return m_buffer.size(); }
+    const unsigned char* data() const { return m_buffer.empty() ? 0 : &m_buffer[0]; }
+
+private:
+    std::vector<unsigned char> m_buffer;
+};
+
+#endif /* WORLDSNAPSHOT_H_ */
@@ -0,0 +1,74 @@
+/*
+ * ChecksumDiff.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Compares two world checksum logs written by WorldChecksum and reports the
+ * first step where the runs diverge.
+ *
+ * Usage: checksumdiff <expected> <actual>
+ *
+ * Exits with 0 when both logs hold identical hashes for the same steps, 1 when
+ * they diverge or one is shorter, and 2 on errors.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool readLine(FILE* file, unsigned& step, unsigned long long& hash)
+{
+    return fscanf(file, "%u %llx", &step, &hash) == 2;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: checksumdiff <expected> <actual>\n");
+        return 2;
+    }
+
+    FILE* expected = fopen(argv[1], "r");
+    FILE* actual = fopen(argv[2], "r");
+    if (!expected || !actual) {
+        fprintf(stderr, "Cannot open %s\n", expected ? argv[2] : argv[1]);
+        return 2;
+    }
+
+    unsigned steps = 0;
+    int result = 0;
+    for (;;) {
+        unsigned expectedStep, actualStep;
+        unsigned long long expectedHash, actualHash;
+        bool hasExpected = readLine(expected, expectedStep, expectedHash);
+        bool hasActual = readLine(actual, actualStep, actualHash);
+
+        if (!hasExpected && !hasActual)
+            break;
+
+        if (hasExpected != hasActual) {
+            printf("%s ends after %u steps, %s continues\n", hasExpected ? argv[2] : argv[1], steps, hasExpected ? argv[1] : argv[2]);
+            result = 1;
+            break;
+        }
+
+        if (expectedStep != actualStep) {
+            fprintf(stderr, "Logs are out of step: %u against %u\n", expectedStep, actualStep);
+            result = 2;
+            break;
+        }
+
+        if (expectedHash != actualHash) {
+            printf("First divergence at step %u: %016llx != %016llx\n", expectedStep, expectedHash, actualHash);
+            result = 1;
+            break;
+        }
+        ++steps;
+    }
+
+    if (!result)
+        printf("%u steps identical\n", steps);
+
+    fclose(expected);
+    fclose(actual);
+    return result;
+}
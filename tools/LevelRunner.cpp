@@ -0,0 +1,390 @@
+/*
+ * LevelRunner.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Runs many independent copies of a level at once, each in its own b2World
+ * and driven by its own scripted or randomized control stream. Used to check
+ * that a level can be completed and to fuzz the player's speed and burst.
+ *
+ * Usage: levelrunner [options] [script...]
+ *   -a dir    Asset directory (default ../Assets/)
+ *   -r count  Number of randomized runs (default 0, or 64 without scripts)
+ *   -j count  Worker threads (default: every online core)
+ *   -s steps  Step limit per run (default 3600, one minute of play)
+ *   -S seed   Base seed for randomized input and fuzzing (default 1)
+ *   -f        Fuzz speed/burst of every run around the level defaults
+ *   -W, -H    Scene size in pixels (default 1280x768)
+ *   -c dir    Write a world checksum log per run to dir/run-<n>.txt, to be
+ *             compared across builds with checksumdiff
+ *
+ * A script holds one control change per line: "<step> <control> start|stop",
+ * for example "30 MoveRight start". Lines starting with '#' are ignored.
+ */
+
+#include "ContactFilter.h"
+#include "ContactListener.h"
+#include "Level.h"
+#include "WorldChecksum.h"
+#include "WorldSettings.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+struct InputEvent {
+    int step;
+    HawkControl control;
+    bool started;
+
+    bool operator<(const InputEvent& other) const { return step < other.step; }
+};
+
+struct RunConfig {
+    int index;
+    std::string source;
+    std::vector<InputEvent> events;
+    unsigned seed;
+    bool fuzz;
+};
+
+struct RunResult {
+    bool reachedGoal;
+    bool fellOut;
+    int steps;
+    double seconds;
+    HawkVector speed;
+    HawkVector burst;
+};
+
+struct RunnerContext {
+    std::string assetRoot;
+    float sceneWidth;
+    float sceneHeight;
+    int maxSteps;
+    std::string checksumDirectory;
+
+    std::vector<RunConfig> runs;
+    std::vector<RunResult> results;
+    volatile int nextRun;
+};
+
+// Small self-contained generator so every run is reproducible from its seed
+// regardless of which thread executes it.
+static unsigned nextRandom(unsigned& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static float randomRange(unsigned& state, float low, float high)
+{
+    return low + (high - low) * (nextRandom(state) % 10000) / 10000.f;
+}
+
+static double now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static const char* const ControlNames[] = {
+    "MoveLeft", "MoveRight", "MoveUp", "MoveDown", "ActionA", "ActionB", "ActionX", "ActionY", "Menu1", "Menu2",
+};
+
+static bool parseControl(const char* name, HawkControl& control)
+{
+    for (unsigned i = 0; i < sizeof(ControlNames) / sizeof(ControlNames[0]); ++i) {
+        if (!strcmp(name, ControlNames[i])) {
+            control = static_cast<HawkControl>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool loadScript(const char* path, RunConfig& run)
+{
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Cannot open script %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file)) {
+        ++lineNumber;
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+
+        InputEvent event;
+        char control[64], state[16];
+        if (sscanf(line, "%d %63s %15s", &event.step, control, state) != 3 || !parseControl(control, event.control)
+            || (strcmp(state, "start") && strcmp(state, "stop"))) {
+            fprintf(stderr, "%s:%d: expected \"<step> <control> start|stop\"\n", path, lineNumber);
+            fclose(file);
+            return false;
+        }
+
+        event.started = !strcmp(state, "start");
+        run.events.push_back(event);
+    }
+    fclose(file);
+
+    std::stable_sort(run.events.begin(), run.events.end());
+    run.source = path;
+    return true;
+}
+
+// Holds a direction for a while, sometimes stops or reverses, and jumps now and then.
+static void generateRandomInput(RunConfig& run, int maxSteps)
+{
+    unsigned state = run.seed;
+    HawkControl held = MoveRight;
+    bool holding = false;
+
+    for (int step = 0; step < maxSteps; step += 10 + nextRandom(state) % 50) {
+        unsigned choice = nextRandom(state) % 10;
+        if (holding) {
+            InputEvent release = { step, held, false };
+            run.events.push_back(release);
+            holding = false;
+        }
+
+        if (choice < 8) {
+            held = (choice < 6) ? MoveRight : MoveLeft;
+            InputEvent press = { step, held, true };
+            run.events.push_back(press);
+            holding = true;
+        }
+
+        if (nextRandom(state) % 3 == 0) {
+            InputEvent jump = { step, ActionA, true };
+            run.events.push_back(jump);
+        }
+    }
+
+    char source[32];
+    snprintf(source, sizeof(source), "random:%u", run.seed);
+    run.source = source;
+}
+
+static void executeRun(const RunnerContext& context, const RunConfig& run, RunResult& result)
+{
+    WorldSettings settings;
+    b2World world(settings.gravity);
+    settings.apply(&world);
+
+    ContactListener contactListener;
+    world.SetContactListener(&contactListener);
+    ContactFilter contactFilter;
+    contactFilter.setSensorMask(PlayerCategory);
+    world.SetContactFilter(&contactFilter);
+
+    Level level;
+    level.load(context.assetRoot, context.sceneWidth, context.sceneHeight);
+
+    std::list<HawkBody*> terrain;
+    level.createTerrain(&world, terrain);
+    DynamicHawkBodyDef def = level.playerDef(&world);
+    if (run.fuzz) {
+        unsigned state = run.seed * 2654435761u + 1;
+        def.speed.x = randomRange(state, def.speed.x * 0.5f, def.speed.x * 1.5f);
+        def.burst.y = randomRange(state, def.burst.y * 0.5f, def.burst.y * 1.5f);
+    }
+    DynamicHawkBody* player = level.createPlayer(def);
+    HawkBody* triggers = level.createTriggers(&world, player);
+
+    WorldChecksum checksum;
+    bool checksums = false;
+    if (!context.checksumDirectory.empty()) {
+        char path[32];
+        snprintf(path, sizeof(path), "/run-%d.txt", run.index);
+        checksums = checksum.openLog((context.checksumDirectory + path).c_str());
+    }
+
+    result.speed = def.speed;
+    result.burst = def.burst;
+    result.reachedGoal = false;
+    result.fellOut = false;
+
+    std::vector<InputEvent>::const_iterator event = run.events.begin();
+    double start = now();
+    int step = 0;
+    for (; step < context.maxSteps; ++step) {
+        for (; event != run.events.end() && event->step <= step; ++event) {
+            if (event->started)
+                player->startControl(event->control);
+            else
+                player->stopControl(event->control);
+        }
+
+        player->applyImpulses();
+        settings.step(&world);
+        if (checksums)
+            checksum.record(&world);
+
+        // Checkpoints are ignored: a run ends the first time the player falls out.
+        contactListener.processEvents();
+        int count = contactListener.processTriggers();
+        for (int i = 0; i < count; ++i) {
+            const TriggerEvent& trigger = contactListener.triggers()[i];
+            const TriggerZone* zone = level.zone(trigger.sensor);
+            if (!trigger.began || trigger.body != player->body() || !zone)
+                continue;
+            if (zone->kind == TriggerZone::Goal)
+                result.reachedGoal = true;
+            else if (zone->kind == TriggerZone::Kill)
+                result.fellOut = true;
+        }
+        if (result.reachedGoal || result.fellOut)
+            break;
+    }
+    result.seconds = now() - start;
+    result.steps = step;
+
+    delete player;
+    delete triggers;
+    for (std::list<HawkBody*>::iterator it = terrain.begin(); it != terrain.end(); ++it)
+        delete *it;
+}
+
+static void* worker(void* data)
+{
+    RunnerContext* context = static_cast<RunnerContext*>(data);
+    const int runCount = context->runs.size();
+
+    for (;;) {
+        int index = __sync_fetch_and_add(&context->nextRun, 1);
+        if (index >= runCount)
+            break;
+        executeRun(*context, context->runs[index], context->results[index]);
+    }
+    return 0;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: levelrunner [-a assets] [-r runs] [-j threads] [-s steps] [-S seed] [-f] [-W width] [-H height] [-c dir] [script...]\n");
+}
+
+int main(int argc, char** argv)
+{
+    RunnerContext context;
+    context.assetRoot = "../Assets/";
+    context.sceneWidth = 1280;
+    context.sceneHeight = 768;
+    context.maxSteps = 3600;
+    context.nextRun = 0;
+
+    int randomRuns = -1;
+    int threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned seed = 1;
+    bool fuzz = false;
+
+    int option;
+    while ((option = getopt(argc, argv, "a:r:j:s:S:fW:H:c:")) != -1) {
+        switch (option) {
+        case 'a':
+            context.assetRoot = optarg;
+            if (!context.assetRoot.empty() && context.assetRoot[context.assetRoot.size() - 1] != '/')
+                context.assetRoot += '/';
+            break;
+        case 'r':
+            randomRuns = atoi(optarg);
+            break;
+        case 'j':
+            threadCount = atoi(optarg);
+            break;
+        case 's':
+            context.maxSteps = atoi(optarg);
+            break;
+        case 'S':
+            seed = strtoul(optarg, 0, 10);
+            break;
+        case 'f':
+            fuzz = true;
+            break;
+        case 'W':
+            context.sceneWidth = atof(optarg);
+            break;
+        case 'H':
+            context.sceneHeight = atof(optarg);
+            break;
+        case 'c':
+            context.checksumDirectory = optarg;
+            break;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (int i = optind; i < argc; ++i) {
+        RunConfig run;
+        run.index = context.runs.size();
+        run.seed = seed + context.runs.size();
+        run.fuzz = fuzz;
+        if (!loadScript(argv[i], run))
+            return EXIT_FAILURE;
+        context.runs.push_back(run);
+    }
+
+    if (randomRuns < 0)
+        randomRuns = context.runs.empty() ? 64 : 0;
+
+    for (int i = 0; i < randomRuns; ++i) {
+        RunConfig run;
+        run.index = context.runs.size();
+        run.seed = seed + context.runs.size();
+        run.fuzz = fuzz;
+        generateRandomInput(run, context.maxSteps);
+        context.runs.push_back(run);
+    }
+
+    if (context.runs.empty()) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    threadCount = std::max(1, std::min<int>(threadCount, context.runs.size()));
+    context.results.resize(context.runs.size());
+
+    double start = now();
+    std::vector<pthread_t> threads(threadCount);
+    for (int i = 0; i < threadCount; ++i)
+        pthread_create(&threads[i], 0, worker, &context);
+    for (int i = 0; i < threadCount; ++i)
+        pthread_join(threads[i], 0);
+    double elapsed = now() - start;
+
+    int reached = 0;
+    long totalSteps = 0;
+    printf("%-4s %-24s %-7s %6s %6s %7s %8s %12s\n", "run", "input", "result", "speed", "burst", "steps", "ms", "steps/s");
+    for (unsigned i = 0; i < context.runs.size(); ++i) {
+        const RunResult& result = context.results[i];
+        const char* outcome = result.reachedGoal ? "goal" : (result.fellOut ? "fell" : "timeout");
+        printf("%-4u %-24s %-7s %6.2f %6.2f %7d %8.2f %12.0f\n", i, context.runs[i].source.c_str(), outcome,
+            result.speed.x, result.burst.y, result.steps, result.seconds * 1000,
+            result.seconds > 0 ? result.steps / result.seconds : 0);
+
+        reached += result.reachedGoal;
+        totalSteps += result.steps;
+    }
+
+    printf("\n%d of %u runs reached the goal\n", reached, static_cast<unsigned>(context.runs.size()));
+    printf("%ld steps on %d threads in %.2f s (%.0f steps/s)\n", totalSteps, threadCount, elapsed, elapsed > 0 ? totalSteps / elapsed : 0);
+
+    return reached ? EXIT_SUCCESS : EXIT_FAILURE;
+}
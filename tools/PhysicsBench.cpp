@@ -0,0 +1,845 @@
+/*
+ * PhysicsBench.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Stress scenes for measuring engine-side physics cost. Every scene is built
+ * through HawkBody/DynamicHawkBody the way the game builds its own and stepped
+ * at the game's fixed rate while b2World::Step is timed.
+ *
+ * Usage: physicsbench [options] [scene...]
+ *   -a dir    Asset directory (default ../Assets/)
+ *   -s steps  Timed steps per scene (default 600)
+ *   -w steps  Untimed warm-up steps per scene (default 60)
+ *   -S seed   Seed for actor input (default 1)
+ *   -v count  Velocity iterations (default 6)
+ *   -p count  Position iterations (default 2)
+ *   -n        Disable sleeping
+ *   -c        Disable continuous physics
+ *   -t count  Island solver threads (default 1)
+ *   -b        Solve contact velocities in SIMD batches
+ *   -g size   Find contact pairs on a broad-phase grid of this cell size
+ *   -C        Check the batched contact solver instead of timing: step a twin
+ *             of each scene with -b, copy the sequential world into it before
+ *             every step and fail if bodies end up further apart on average
+ *             than the tolerances below
+ *   -R        Also measure WorldSnapshot round trips on the settled scene
+ *   -Q        Also measure terrain queries through both TerrainIndex backends
+ *   -N        Also measure NavGraph build and path costs
+ *   -P        Also compare pair finding on the broad-phase tree and grid
+ *   -l        List the scenes and exit
+ *
+ * Without scene names every scene runs. Scenes, by name prefix:
+ *   platforms-N       N static platforms with a light rain of blocks
+ *   pile-N            N blocks settling into a pile in a container
+ *   actors-N          N actors each applying their own movement impulses
+ *   actors-batched-N  The same actors driven by one ActorController
+ *   kinematic-N       N KinematicHawkBody characters moved by ray casts
+ *   sand-N            N ParticleSystem grains poured into a container
+ *
+ * Each scene prints one JSON object per line with:
+ *   step times        mean and percentiles of b2World::Step in milliseconds
+ *   control           time spent driving actors before each step
+ *   sand              ParticleSystem::update time after each step, and grains
+ *                     in all and awake
+ *   contacts          contact and touching counts
+ *   islands           island count and size, and TOI events solved by
+ *                     continuous collision, from PhysicsStats
+ *   checksum          WorldChecksum of the final state, to compare settings
+ *
+ * The optional measurements run on the scene after the timed steps and print
+ * a line of their own, tagged with the scene and measurement name:
+ *   snapshot (-R)     WorldSnapshot size and capture/restore cost
+ *   queries (-Q)      cost through the tree and grid TerrainIndex backends; the
+ *                     run fails if their hit counts differ
+ *   navigation (-N)   NavGraph build cost and uncached and cached path cost
+ *   pairs (-P)        time of b2BroadPhase::UpdatePairs on the tree and on a
+ *                     grid of -g cells (2 m if unset) and the pairs each finds,
+ *                     once with every proxy moved and once with only the
+ *                     non-static ones; the run fails if the pair counts differ
+ */
+
+#include "ActorController.h"
+#include "HawkBody.h"
+#include "KinematicHawkBody.h"
+#include "NavGraph.h"
+#include "ParticleSystem.h"
+#include "PhysicsStats.h"
+#include "TerrainIndex.h"
+#include "WorldChecksum.h"
+#include "WorldSettings.h"
+#include "WorldSnapshot.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <list>
+#include <string>
+#include <vector>
+
+static std::string s_assetRoot = "../Assets/";
+static WorldSettings s_settings;
+static bool s_measureSnapshot = false;
+static bool s_measureQueries = false;
+static bool s_measureNavigation = false;
+static bool s_measurePairs = false;
+
+// Root mean square per-step difference -C accepts between the sequential and
+// batched contact solvers, over every body and step, in metres and metres per
+// second. Batches solve contacts in a different order, so single impacts in
+// crowds and tall stacks, where friction leaves more than one answer, can
+// differ by far more; the largest difference is reported but not judged.
+static const float BatchPositionTolerance = 5e-3f;
+static const float BatchVelocityTolerance = 0.25f;
+
+static std::string asset(const char* name)
+{
+    return s_assetRoot + name;
+}
+
+static double now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned nextRandom(unsigned& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+class Scene {
+public:
+    Scene(unsigned seed, const WorldSettings& settings = s_settings)
+        : m_world(settings.gravity)
+        , m_seed(seed ? seed : 1)
+        , m_sandWidth(0)
+    {
+        settings.apply(&m_world);
+    }
+
+    ~Scene()
+    {
+        for (std::list<HawkBody*>::iterator it = m_bodies.begin(); it != m_bodies.end(); ++it)
+            delete *it;
+    }
+
+    b2World* world() { return &m_world; }
+
+    HawkBody* addStatic(const char* sprite, const HawkPoint& center)
+    {
+        HawkBodyDef def;
+        def.world = &m_world;
+        return add(new HawkBody(def), sprite, center);
+    }
+
+    DynamicHawkBody* addDynamic(const char* sprite, const HawkPoint& center, bool fixedRotation)
+    {
+        DynamicHawkBodyDef def;
+        def.world = &m_world;
+        def.speed = HawkVector(4, 4);
+        def.burst = HawkVector(8, 8);
+        def.fixedRotation = fixedRotation;
+        return static_cast<DynamicHawkBody*>(add(new DynamicHawkBody(def), sprite, center));
+    }
+
+    // Batched actors are moved by the ActorController instead of one at a time.
+    DynamicHawkBody* addActor(const HawkPoint& center, bool batched)
+    {
+        DynamicHawkBody* actor = addDynamic("resting_small.png", center, true);
+        if (batched)
+            m_controller.add(actor);
+        else
+            m_actors.push_back(actor);
+        return actor;
+    }
+
+    // Kinematic actors move by raycasting and never enter the contact solver.
+    KinematicHawkBody* addKinematic(const HawkPoint& center)
+    {
+        KinematicHawkBodyDef def;
+        def.world = &m_world;
+        def.categoryBits = ActorCategory;
+        KinematicHawkBody* actor = static_cast<KinematicHawkBody*>(add(new KinematicHawkBody(def), "resting_small.png", center));
+        m_kinematic.push_back(actor);
+        return actor;
+    }
+
+    // Grains are poured in bursts at the top of a container width pixels wide
+    // until there are grains of them. Add after the static bodies.
+    void addSand(int grains, float width)
+    {
+        m_terrain.build(&m_world);
+        m_sand.create(grains, 2.0f);
+        m_sand.setLifetime(FLT_MAX);
+        m_sandWidth = width;
+    }
+
+    // Called after every step, as GameLogic does.
+    void updateSand()
+    {
+        if (!m_sand.capacity())
+            return;
+
+        const int bursts = 8;
+        for (int i = 0; i < bursts; ++i)
+            m_sand.emit(HawkPoint((i + 0.5f) * m_sandWidth / bursts, 600), 250, 6);
+        m_sand.update(s_settings.timeStep, m_world.GetGravity(), m_terrain);
+    }
+
+    int grainCount() const { return m_sand.count(); }
+    int awakeGrainCount() const { return m_sand.awakeCount(); }
+
+    // Floor and walls out of ground tiles so piles stay in view.
+    void addContainer(float width, float height)
+    {
+        for (float x = 135; x < width; x += 270)
+            addStatic("ground.png", HawkPoint(x, 17));
+
+        for (float y = 34; y < height; y += 270) {
+            addWall(HawkPoint(-17, y + 135));
+            addWall(HawkPoint(width + 17, y + 135));
+        }
+    }
+
+    // Called before every step. Actors change direction and jump at random.
+    void driveActors()
+    {
+        for (unsigned i = 0; i < m_actors.size(); ++i) {
+            unsigned roll = nextRandom(m_seed) % 64;
+            if (roll == 0)
+                m_actors[i]->startControl(MoveLeft);
+            else if (roll == 1)
+                m_actors[i]->startControl(MoveRight);
+            else if (roll == 2)
+                m_actors[i]->startControl(ActionA);
+            else if (roll == 3)
+                m_actors[i]->stopControl(MoveRight);
+            m_actors[i]->applyImpulses();
+        }
+
+        for (int i = 0; i < m_controller.size(); ++i) {
+            unsigned roll = nextRandom(m_seed) % 64;
+            if (roll == 0)
+                m_controller.setHorizontalMovement(i, DynamicHawkBody::NegativeCruise);
+            else if (roll == 1)
+                m_controller.setHorizontalMovement(i, DynamicHawkBody::PositiveCruise);
+            else if (roll == 2)
+                m_controller.setVerticalMovement(i, DynamicHawkBody::PositiveBurst);
+            else if (roll == 3)
+                m_controller.setHorizontalMovement(i, DynamicHawkBody::Stop);
+        }
+        m_controller.applyImpulses();
+
+        for (unsigned i = 0; i < m_kinematic.size(); ++i) {
+            unsigned roll = nextRandom(m_seed) % 64;
+            if (roll == 0)
+                m_kinematic[i]->startControl(MoveLeft);
+            else if (roll == 1)
+                m_kinematic[i]->startControl(MoveRight);
+            else if (roll == 2)
+                m_kinematic[i]->startControl(ActionA);
+            else if (roll == 3)
+                m_kinematic[i]->stopControl(MoveRight);
+            m_kinematic[i]->update(s_settings.timeStep);
+        }
+    }
+
+    int bodyCount() const { return m_bodies.size(); }
+
+    ActorController* controller() { return &m_controller; }
+
+private:
+    HawkBody* add(HawkBody* body, const char* sprite, const HawkPoint& center)
+    {
+        body->createSprite(asset(sprite).c_str());
+        body->createBody(center);
+        body->createFixtureFromSprite();
+        m_bodies.push_back(body);
+        return body;
+    }
+
+    void addWall(const HawkPoint& center)
+    {
+        HawkBody* wall = addStatic("ground.png", center);
+        wall->body()->SetTransform(wall->body()->GetPosition(), b2_pi / 2);
+    }
+
+    b2World m_world;
+    std::list<HawkBody*> m_bodies;
+    std::vector<DynamicHawkBody*> m_actors;
+    std::vector<KinematicHawkBody*> m_kinematic;
+    ActorController m_controller;
+    unsigned m_seed;
+    TerrainIndex m_terrain;
+    ParticleSystem m_sand;
+    float m_sandWidth;
+};
+
+// A wide field of static platforms with a light rain of blocks across it.
+static void buildPlatformField(Scene& scene, int platforms)
+{
+    int columns = 32;
+    for (int i = 0; i < platforms; ++i)
+        scene.addStatic("ground.png", HawkPoint((i % columns) * 320.f, (i / columns) * 150.f));
+
+    for (int i = 0; i < platforms / 8; ++i)
+        scene.addDynamic("belligerent_small.png", HawkPoint((i % columns) * 320.f + 40, (i / columns) * 1200.f + 500), false);
+}
+
+// Blocks dropped in a staggered grid into a container so they settle into a pile.
+static void buildPile(Scene& scene, int blocks)
+{
+    int columns = 40;
+    float width = columns * 70.f;
+    scene.addContainer(width, 4000);
+
+    for (int i = 0; i < blocks; ++i) {
+        float x = 40 + (i % columns) * 68.f + ((i / columns) % 2) * 20.f;
+        float y = 100 + (i / columns) * 72.f;
+        scene.addDynamic("belligerent_small.png", HawkPoint(x, y), false);
+    }
+}
+
+// Many actors running the player movement code against each other and the floor.
+static void addActors(Scene& scene, int actors, bool batched)
+{
+    int columns = 50;
+    scene.addContainer(columns * 80.f, 4000);
+
+    for (int i = 0; i < actors; ++i)
+        scene.addActor(HawkPoint(60 + (i % columns) * 80.f, 100 + (i / columns) * 90.f), batched);
+}
+
+static void buildActors(Scene& scene, int actors)
+{
+    addActors(scene, actors, false);
+}
+
+static void buildBatchedActors(Scene& scene, int actors)
+{
+    addActors(scene, actors, true);
+}
+
+// Sand poured onto the floor of a container, piling up against its walls.
+static void buildSand(Scene& scene, int grains)
+{
+    // Five floor tiles, so the floor meets both walls and no grain falls out.
+    float width = 1350;
+    scene.addContainer(width, 1000);
+    scene.addSand(grains, width);
+}
+
+static void buildKinematicActors(Scene& scene, int actors)
+{
+    int columns = 50;
+    scene.addContainer(columns * 80.f, 4000);
+
+    for (int i = 0; i < actors; ++i)
+        scene.addKinematic(HawkPoint(60 + (i % columns) * 80.f, 100 + (i / columns) * 90.f));
+}
+
+struct SceneInfo {
+    const char* name;
+    void (*build)(Scene&, int);
+    int size;
+};
+
+static const SceneInfo Scenes[] = {
+    { "platforms-512", buildPlatformField, 512 },
+    { "platforms-4096", buildPlatformField, 4096 },
+    { "pile-250", buildPile, 250 },
+    { "pile-1000", buildPile, 1000 },
+    { "pile-2500", buildPile, 2500 },
+    { "actors-100", buildActors, 100 },
+    { "actors-500", buildActors, 500 },
+    { "actors-batched-100", buildBatchedActors, 100 },
+    { "actors-batched-500", buildBatchedActors, 500 },
+    { "kinematic-100", buildKinematicActors, 100 },
+    { "kinematic-500", buildKinematicActors, 500 },
+    { "sand-1024", buildSand, 1024 },
+    { "sand-4096", buildSand, 4096 },
+};
+
+static const int SceneCount = sizeof(Scenes) / sizeof(Scenes[0]);
+
+namespace {
+
+class CountingQuery : public b2QueryCallback {
+public:
+    CountingQuery()
+        : hits(0)
+    { }
+
+    virtual bool ReportFixture(b2Fixture*)
+    {
+        ++hits;
+        return true;
+    }
+
+    long hits;
+};
+
+}
+
+struct QueryResult {
+    double buildTime;
+    double queryTime;
+    long hits;
+};
+
+// WorldSnapshot cost on the settled scene, averaged over repeated round trips.
+static void measureSnapshot(const char* name, b2World* world)
+{
+    const int rounds = 100;
+    WorldSnapshot snapshot;
+    snapshot.capture(world);
+    double start = now();
+    for (int i = 0; i < rounds; ++i)
+        snapshot.capture(world);
+    double captureTime = (now() - start) / rounds;
+    start = now();
+    for (int i = 0; i < rounds; ++i)
+        snapshot.restore(world);
+    double restoreTime = (now() - start) / rounds;
+
+    printf("{\"scene\":\"%s\",\"measure\":\"snapshot\",\"snapshot_bytes\":%u,\"capture_us\":%.2f,\"restore_us\":%.2f}\n",
+        name, static_cast<unsigned>(snapshot.byteSize()), captureTime * 1e6, restoreTime * 1e6);
+}
+
+// Character-sized AABB queries scattered over the static geometry.
+static QueryResult measureTerrainQueries(b2World* world, TerrainIndex::Backend backend, unsigned seed)
+{
+    const int queryCount = 2000;
+    QueryResult result = { 0, 0, 0 };
+
+    b2AABB bounds;
+    bool empty = true;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        if (body->GetType() != b2_staticBody)
+            continue;
+        for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext()) {
+            if (empty)
+                bounds = fixture->GetAABB(0);
+            else
+                bounds.Combine(fixture->GetAABB(0));
+            empty = false;
+        }
+    }
+    if (empty)
+        return result;
+
+    TerrainIndex index(backend, s_settings.terrainCellSize);
+    double start = now();
+    index.build(world);
+    result.buildTime = now() - start;
+
+    CountingQuery counter;
+    HawkVector extent = bounds.upperBound - bounds.lowerBound;
+    start = now();
+    for (int i = 0; i < queryCount; ++i) {
+        b2AABB aabb;
+        aabb.lowerBound.x = bounds.lowerBound.x + extent.x * (nextRandom(seed) % 1000) / 1000.f;
+        aabb.lowerBound.y = bounds.lowerBound.y + extent.y * (nextRandom(seed) % 1000) / 1000.f;
+        aabb.upperBound = aabb.lowerBound + HawkVector(1.5f, 1.5f);
+        index.query(&counter, aabb);
+    }
+    result.queryTime = (now() - start) / queryCount;
+    result.hits = counter.hits;
+    return result;
+}
+
+static double percentile(const std::vector<double>& sorted, double fraction)
+{
+    if (sorted.empty())
+        return 0;
+    size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+struct NavResult {
+    int surfaces;
+    int links;
+    double buildTime;
+    double pathTime;
+    double cachedPathTime;
+    int paths;
+};
+
+static NavResult measureNavigation(b2World* world, unsigned seed)
+{
+    const int pairCount = 500;
+    NavResult result = { 0, 0, 0, 0, 0, 0 };
+
+    DynamicHawkBodyDef mover;
+    mover.world = world;
+    mover.speed = HawkVector(4, 4);
+    mover.burst = HawkVector(8, 8);
+
+    NavGraph graph;
+    double start = now();
+    graph.build(world, mover);
+    result.buildTime = now() - start;
+    result.surfaces = graph.surfaceCount();
+    result.links = graph.linkCount();
+    if (!result.surfaces)
+        return result;
+
+    std::vector<std::pair<int, int> > pairs(pairCount);
+    for (int i = 0; i < pairCount; ++i)
+        pairs[i] = std::make_pair(nextRandom(seed) % result.surfaces, nextRandom(seed) % result.surfaces);
+
+    start = now();
+    for (int i = 0; i < pairCount; ++i)
+        result.paths += graph.findPath(pairs[i].first, pairs[i].second) != 0;
+    result.pathTime = (now() - start) / pairCount;
+
+    start = now();
+    for (int i = 0; i < pairCount; ++i)
+        graph.findPath(pairs[i].first, pairs[i].second);
+    result.cachedPathTime = (now() - start) / pairCount;
+    return result;
+}
+
+// Returns false when the terrain backends disagree.
+static bool compareTerrainQueries(const char* name, b2World* world, unsigned seed)
+{
+    QueryResult tree = measureTerrainQueries(world, TerrainIndex::TreeBackend, seed);
+    QueryResult grid = measureTerrainQueries(world, TerrainIndex::GridBackend, seed);
+    printf("{\"scene\":\"%s\",\"measure\":\"queries\",\"query_tree_us\":%.3f,\"query_grid_us\":%.3f,\"grid_build_ms\":%.3f,"
+        "\"query_hits_tree\":%ld,\"query_hits_grid\":%ld}\n",
+        name, tree.queryTime * 1e6, grid.queryTime * 1e6, grid.buildTime * 1000, tree.hits, grid.hits);
+
+    if (tree.hits != grid.hits) {
+        fprintf(stderr, "%s: tree found %ld terrain hits, grid %ld\n", name, tree.hits, grid.hits);
+        return false;
+    }
+    return true;
+}
+
+class PairCounter {
+public:
+    PairCounter()
+        : pairs(0)
+    { }
+
+    void AddPair(void*, void*) { ++pairs; }
+
+    long pairs;
+};
+
+struct PairResult {
+    double allTime;
+    double movedTime;
+    long allPairs;
+    long movedPairs;
+};
+
+// UpdatePairs on a broad-phase of the scene's fixtures outside the world, so
+// only pair finding is timed. A cell size of zero uses the tree.
+static PairResult measurePairs(b2World* world, float cellSize)
+{
+    const int rounds = 20;
+    PairResult result = { 0, 0, 0, 0 };
+
+    b2BroadPhase broadPhase;
+#ifdef B2_GRID_BROADPHASE
+    broadPhase.SetGridCellSize(cellSize);
+#endif
+    std::vector<int32> proxies, moving;
+    for (b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+        for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext()) {
+            for (int32 child = 0; child < fixture->GetShape()->GetChildCount(); ++child) {
+                int32 proxy = broadPhase.CreateProxy(fixture->GetAABB(child), fixture);
+                proxies.push_back(proxy);
+                if (body->GetType() != b2_staticBody)
+                    moving.push_back(proxy);
+            }
+        }
+    }
+    PairCounter first;
+    broadPhase.UpdatePairs(&first);
+
+    PairCounter all;
+    double start = now();
+    for (int i = 0; i < rounds; ++i) {
+        for (unsigned j = 0; j < proxies.size(); ++j)
+            broadPhase.TouchProxy(proxies[j]);
+        broadPhase.UpdatePairs(&all);
+    }
+    result.allTime = (now() - start) / rounds;
+    result.allPairs = all.pairs / rounds;
+
+    PairCounter moved;
+    start = now();
+    for (int i = 0; i < rounds; ++i) {
+        for (unsigned j = 0; j < moving.size(); ++j)
+            broadPhase.TouchProxy(moving[j]);
+        broadPhase.UpdatePairs(&moved);
+    }
+    result.movedTime = (now() - start) / rounds;
+    result.movedPairs = moved.pairs / rounds;
+    return result;
+}
+
+// Returns false when the tree and grid find different pairs.
+static bool comparePairs(const char* name, b2World* world)
+{
+#ifdef B2_GRID_BROADPHASE
+    float cellSize = s_settings.broadPhaseCellSize > 0 ? s_settings.broadPhaseCellSize : 2.0f;
+    PairResult tree = measurePairs(world, 0);
+    PairResult grid = measurePairs(world, cellSize);
+    printf("{\"scene\":\"%s\",\"measure\":\"pairs\",\"cell_size\":%g,\"pairs_all_tree_ms\":%.4f,\"pairs_all_grid_ms\":%.4f,"
+        "\"pairs_all\":%ld,\"pairs_moved_tree_ms\":%.4f,\"pairs_moved_grid_ms\":%.4f,\"pairs_moved\":%ld}\n",
+        name, cellSize, tree.allTime * 1000, grid.allTime * 1000, tree.allPairs,
+        tree.movedTime * 1000, grid.movedTime * 1000, tree.movedPairs);
+
+    if (tree.allPairs != grid.allPairs || tree.movedPairs != grid.movedPairs) {
+        fprintf(stderr, "%s: tree found %ld/%ld pairs, grid %ld/%ld\n", name, tree.allPairs, tree.movedPairs, grid.allPairs, grid.movedPairs);
+        return false;
+    }
+    return true;
+#else
+    fprintf(stderr, "%s: pair comparison needs Box2D built with Res/Box2D_patches\n", name);
+    (void)world;
+    return false;
+#endif
+}
+
+static void printNavigation(const char* name, b2World* world, unsigned seed)
+{
+    NavResult nav = measureNavigation(world, seed);
+    printf("{\"scene\":\"%s\",\"measure\":\"navigation\",\"nav_surfaces\":%d,\"nav_links\":%d,\"nav_build_ms\":%.3f,"
+        "\"path_us\":%.3f,\"path_cached_us\":%.3f,\"paths_found\":%d}\n",
+        name, nav.surfaces, nav.links, nav.buildTime * 1000, nav.pathTime * 1e6, nav.cachedPathTime * 1e6, nav.paths);
+}
+
+// Returns false when an optional measurement fails its check.
+static bool runScene(const SceneInfo& info, int steps, int warmup, unsigned seed)
+{
+    Scene scene(seed);
+    info.build(scene, info.size);
+    b2World* world = scene.world();
+
+    for (int i = 0; i < warmup; ++i) {
+        scene.driveActors();
+        s_settings.step(world);
+        scene.updateSand();
+    }
+
+    std::vector<double> times;
+    times.reserve(steps);
+    double contacts = 0, touching = 0, islands = 0, toiEvents = 0, sand = 0, grains = 0, awakeGrains = 0;
+    int maxContacts = 0, largestIsland = 0;
+    PhysicsStats stats;
+
+    double control = 0;
+    for (int i = 0; i < steps; ++i) {
+        double start = now();
+        scene.driveActors();
+        control += now() - start;
+
+        start = now();
+        s_settings.step(world);
+        times.push_back((now() - start) * 1000);
+
+        start = now();
+        scene.updateSand();
+        sand += now() - start;
+        grains += scene.grainCount();
+        awakeGrains += scene.awakeGrainCount();
+
+        const PhysicsStepStats& step = stats.collect(world);
+        contacts += step.contacts;
+        maxContacts = std::max(maxContacts, step.contacts);
+        touching += step.touchingContacts;
+        islands += step.islands;
+        largestIsland = std::max(largestIsland, step.largestIsland);
+        toiEvents += step.toiEvents;
+    }
+
+    // Same on any number of island threads; compare runs to check.
+    uint64_t checksum = WorldChecksum::compute(world);
+
+    double total = 0;
+    for (unsigned i = 0; i < times.size(); ++i)
+        total += times[i];
+    std::sort(times.begin(), times.end());
+
+    printf("{\"scene\":\"%s\",\"bodies\":%d,\"steps\":%d,\"mean_ms\":%.4f,\"p50_ms\":%.4f,\"p90_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f,"
+        "\"control_mean_ms\":%.4f,\"sand_mean_ms\":%.4f,\"grains_mean\":%.0f,\"awake_grains_mean\":%.0f,\"contacts_mean\":%.1f,\"contacts_max\":%d,\"touching_mean\":%.1f,"
+        "\"islands_mean\":%.1f,\"island_max\":%d,\"toi_events_mean\":%.2f,\"island_threads\":%d,\"batch_contacts\":%s,\"broadphase_cell_size\":%g,\"checksum\":\"%016llx\"}\n",
+        info.name, scene.bodyCount(), steps, steps ? total / steps : 0, percentile(times, 0.5), percentile(times, 0.9),
+        percentile(times, 0.99), times.empty() ? 0 : times.back(), steps ? control * 1000 / steps : 0,
+        steps ? sand * 1000 / steps : 0, steps ? grains / steps : 0, steps ? awakeGrains / steps : 0, steps ? contacts / steps : 0, maxContacts,
+        steps ? touching / steps : 0, steps ? islands / steps : 0, largestIsland, steps ? toiEvents / steps : 0,
+        s_settings.islandThreads, s_settings.batchContacts ? "true" : "false", s_settings.broadPhaseCellSize,
+        static_cast<unsigned long long>(checksum));
+
+    bool passed = true;
+    if (s_measureSnapshot)
+        measureSnapshot(info.name, world);
+    if (s_measureQueries && !compareTerrainQueries(info.name, world, seed))
+        passed = false;
+    if (s_measureNavigation)
+        printNavigation(info.name, world, seed);
+    if (s_measurePairs && !comparePairs(info.name, world))
+        passed = false;
+    fflush(stdout);
+    return passed;
+}
+
+// Steps the scene and a twin solving contacts in batches side by side. Before
+// every step the twin is set to the sequential world's state, so only one
+// step's worth of solver difference is measured rather than chaos piling up.
+// Returns false when a body drifts further than the tolerances.
+static bool checkBatching(const SceneInfo& info, int steps, int warmup, unsigned seed)
+{
+    WorldSettings batched = s_settings;
+    batched.batchContacts = true;
+
+    Scene scene(seed);
+    Scene twin(seed, batched);
+    info.build(scene, info.size);
+    info.build(twin, info.size);
+
+    WorldSnapshot snapshot;
+    double positionSquares = 0, velocitySquares = 0;
+    float positionError = 0, velocityError = 0;
+    long samples = 0;
+    for (int i = 0; i < warmup + steps; ++i) {
+        snapshot.capture(scene.world(), scene.controller());
+        snapshot.restore(twin.world(), twin.controller());
+
+        scene.driveActors();
+        twin.driveActors();
+        s_settings.step(scene.world());
+        batched.step(twin.world());
+
+        if (i < warmup)
+            continue;
+
+        for (b2Body* a = scene.world()->GetBodyList(), *b = twin.world()->GetBodyList(); a && b; a = a->GetNext(), b = b->GetNext()) {
+            float position = std::max((a->GetPosition() - b->GetPosition()).Length(), fabsf(a->GetAngle() - b->GetAngle()));
+            float velocity = std::max((a->GetLinearVelocity() - b->GetLinearVelocity()).Length(),
+                fabsf(a->GetAngularVelocity() - b->GetAngularVelocity()));
+            positionSquares += position * position;
+            velocitySquares += velocity * velocity;
+            ++samples;
+            positionError = std::max(positionError, position);
+            velocityError = std::max(velocityError, velocity);
+        }
+    }
+
+    float positionRms = samples ? sqrt(positionSquares / samples) : 0;
+    float velocityRms = samples ? sqrt(velocitySquares / samples) : 0;
+    bool passed = positionRms <= BatchPositionTolerance && velocityRms <= BatchVelocityTolerance;
+    printf("{\"scene\":\"%s\",\"bodies\":%d,\"steps\":%d,\"batch_check\":\"%s\",\"position_rms\":%g,\"velocity_rms\":%g,"
+        "\"position_max\":%g,\"velocity_max\":%g,\"position_tolerance\":%g,\"velocity_tolerance\":%g}\n",
+        info.name, scene.bodyCount(), steps, passed ? "pass" : "fail", positionRms, velocityRms, positionError, velocityError,
+        BatchPositionTolerance, BatchVelocityTolerance);
+    fflush(stdout);
+
+    if (!passed)
+        fprintf(stderr, "%s: batched contacts drifted %g m, %g m/s on average from the sequential solver\n", info.name, positionRms, velocityRms);
+    return passed;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: physicsbench [-a assets] [-s steps] [-w warmup] [-S seed] [-v iterations] [-p iterations] [-n] [-c] [-t threads] [-b] [-g size] [-C] [-R] [-Q] [-N] [-P] [-l] [scene...]\n");
+}
+
+int main(int argc, char** argv)
+{
+    int steps = 600;
+    int warmup = 60;
+    unsigned seed = 1;
+    bool checkBatches = false;
+
+    int option;
+    while ((option = getopt(argc, argv, "a:s:w:S:v:p:nct:bg:CRQNPl")) != -1) {
+        switch (option) {
+        case 'a':
+            s_assetRoot = optarg;
+            if (!s_assetRoot.empty() && s_assetRoot[s_assetRoot.size() - 1] != '/')
+                s_assetRoot += '/';
+            break;
+        case 's':
+            steps = atoi(optarg);
+            break;
+        case 'w':
+            warmup = atoi(optarg);
+            break;
+        case 'S':
+            seed = strtoul(optarg, 0, 10);
+            break;
+        case 'v':
+            s_settings.velocityIterations = atoi(optarg);
+            break;
+        case 'p':
+            s_settings.positionIterations = atoi(optarg);
+            break;
+        case 'n':
+            s_settings.allowSleeping = false;
+            break;
+        case 'c':
+            s_settings.continuousPhysics = false;
+            break;
+        case 't':
+            s_settings.islandThreads = std::max(1, atoi(optarg));
+            break;
+        case 'b':
+            s_settings.batchContacts = true;
+            break;
+        case 'g':
+            s_settings.broadPhaseCellSize = atof(optarg);
+            break;
+        case 'C':
+            checkBatches = true;
+            break;
+        case 'R':
+            s_measureSnapshot = true;
+            break;
+        case 'Q':
+            s_measureQueries = true;
+            break;
+        case 'N':
+            s_measureNavigation = true;
+            break;
+        case 'P':
+            s_measurePairs = true;
+            break;
+        case 'l':
+            for (int i = 0; i < SceneCount; ++i)
+                printf("%s\n", Scenes[i].name);
+            return EXIT_SUCCESS;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    bool passed = true;
+    for (int i = 0; i < SceneCount; ++i) {
+        bool selected = optind == argc;
+        for (int j = optind; j < argc && !selected; ++j)
+            selected = !strcmp(argv[j], Scenes[i].name);
+        if (!selected)
+            continue;
+        if (!(checkBatches ? checkBatching(Scenes[i], steps, warmup, seed) : runScene(Scenes[i], steps, warmup, seed)))
+            passed = false;
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
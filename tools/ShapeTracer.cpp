@@ -0,0 +1,516 @@
+/*
+ * ShapeTracer.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Traces the opaque outline of PNG sprites into convex collision polygons and
+ * writes them next to each image as a .shape file for SpriteShape to load.
+ *
+ * Usage: shapetracer [-a alpha] [-v vertices] [-p polygons] [-q] image.png...
+ *   -a alpha     Alpha above which a pixel is solid, 0-255 (default 127)
+ *   -v vertices  Vertex budget for the simplified outline (default 16)
+ *   -p polygons  Polygon budget for the whole shape (default 4)
+ *   -q           Only report errors
+ *
+ * The outline of the first opaque region found (scanning from the top left) is
+ * followed with marching squares, simplified with Ramer-Douglas-Peucker until
+ * it fits the vertex budget, triangulated by ear clipping and the triangles
+ * merged back into convex polygons of at most b2_maxPolygonVertices. Holes and
+ * further separate regions are ignored.
+ *
+ * Vertices closer than MinThickness to the line through their neighbours are
+ * dropped before triangulating, and polygons thinner than MinThickness or
+ * smaller than MinArea afterwards: Box2D treats such slivers as solid
+ * b2_polygonRadius skins, and a pile of them costs hundreds of contacts per
+ * body. When the polygons still exceed the budget the outline is traced again
+ * with one vertex fewer.
+ */
+
+#include "SpriteShape.h"
+
+#include <png.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+typedef std::vector<HawkPoint> Outline;
+typedef std::vector<std::vector<int> > Polygons;
+
+// A few times b2_linearSlop, in sprite pixels.
+static const float MinThickness = Hawk::m2Pix(4 * b2_linearSlop);
+static const float MinArea = 4 * MinThickness * MinThickness;
+
+struct AlphaImage {
+    int width;
+    int height;
+    std::vector<unsigned char> alpha;
+
+    bool solid(int x, int y, int threshold) const
+    {
+        return x >= 0 && y >= 0 && x < width && y < height && alpha[y * width + x] > threshold;
+    }
+};
+
+static bool readAlpha(const char* path, AlphaImage& image)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    png_byte header[8];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || png_sig_cmp(header, 0, sizeof(header))) {
+        fprintf(stderr, "%s is not a PNG\n", path);
+        fclose(file);
+        return false;
+    }
+
+    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, 0, 0, 0);
+    png_infop info = png ? png_create_info_struct(png) : 0;
+    if (!info || setjmp(png_jmpbuf(png))) {
+        fprintf(stderr, "Cannot decode %s\n", path);
+        png_destroy_read_struct(&png, &info, 0);
+        fclose(file);
+        return false;
+    }
+
+    png_init_io(png, file);
+    png_set_sig_bytes(png, sizeof(header));
+    png_read_info(png, info);
+
+    // Expand everything to 8 bit RGBA so the alpha is always the fourth byte.
+    png_set_expand(png);
+    png_set_strip_16(png);
+    png_set_gray_to_rgb(png);
+    png_set_add_alpha(png, 0xff, PNG_FILLER_AFTER);
+    png_read_update_info(png, info);
+
+    image.width = png_get_image_width(png, info);
+    image.height = png_get_image_height(png, info);
+
+    std::vector<png_byte> pixels(image.width * image.height * 4);
+    std::vector<png_bytep> rows(image.height);
+    for (int y = 0; y < image.height; ++y)
+        rows[y] = &pixels[y * image.width * 4];
+    png_read_image(png, &rows[0]);
+    png_destroy_read_struct(&png, &info, 0);
+    fclose(file);
+
+    image.alpha.resize(image.width * image.height);
+    for (int i = 0; i < image.width * image.height; ++i)
+        image.alpha[i] = pixels[i * 4 + 3];
+    return true;
+}
+
+/*
+ * Marching squares over 2x2 windows of pixels. The window at (x, y) covers the
+ * pixels (x - 1, y - 1) to (x, y) and its corner point is (x, y) in pixel-edge
+ * coordinates, so the outline runs along pixel edges. Only corners where the
+ * direction changes are kept.
+ */
+static bool traceOutline(const AlphaImage& image, int threshold, Outline& outline)
+{
+    int startX = -1, startY = -1;
+    for (int y = 0; y < image.height && startX < 0; ++y) {
+        for (int x = 0; x < image.width; ++x) {
+            if (image.solid(x, y, threshold)) {
+                startX = x;
+                startY = y;
+                break;
+            }
+        }
+    }
+    if (startX < 0)
+        return false;
+
+    enum Step { None, Up, Down, Left, Right };
+    int x = startX, y = startY;
+    Step previous = None;
+    const int limit = 4 * (image.width + 1) * (image.height + 1);
+
+    for (int steps = 0; steps < limit; ++steps) {
+        int state = (image.solid(x - 1, y - 1, threshold) ? 1 : 0)
+            | (image.solid(x, y - 1, threshold) ? 2 : 0)
+            | (image.solid(x - 1, y, threshold) ? 4 : 0)
+            | (image.solid(x, y, threshold) ? 8 : 0);
+
+        Step next;
+        switch (state) {
+        case 1: case 5: case 13: next = Up; break;
+        case 2: case 3: case 7: next = Right; break;
+        case 4: case 12: case 14: next = Left; break;
+        case 8: case 10: case 11: next = Down; break;
+        case 6: next = previous == Up ? Left : Right; break;
+        case 9: next = previous == Right ? Up : Down; break;
+        default:
+            return false;
+        }
+
+        if (next != previous)
+            outline.push_back(HawkPoint(x, y));
+        previous = next;
+
+        switch (next) {
+        case Up: --y; break;
+        case Down: ++y; break;
+        case Left: --x; break;
+        case Right: ++x; break;
+        default: break;
+        }
+
+        if (x == startX && y == startY)
+            return outline.size() >= 3;
+    }
+    return false;
+}
+
+static float distanceToSegment(const HawkPoint& p, const HawkPoint& a, const HawkPoint& b)
+{
+    HawkVector ab = b - a;
+    float length = ab.LengthSquared();
+    float t = length > 0 ? b2Dot(p - a, ab) / length : 0;
+    t = std::max(0.f, std::min(1.f, t));
+    return (p - (a + t * ab)).Length();
+}
+
+static void simplifyRange(const Outline& points, int first, int last, float epsilon, std::vector<bool>& keep)
+{
+    float farthest = 0;
+    int index = -1;
+    for (int i = first + 1; i < last; ++i) {
+        float distance = distanceToSegment(points[i], points[first], points[last % points.size()]);
+        if (distance > farthest) {
+            farthest = distance;
+            index = i;
+        }
+    }
+    if (index < 0 || farthest <= epsilon)
+        return;
+
+    keep[index] = true;
+    simplifyRange(points, first, index, epsilon, keep);
+    simplifyRange(points, index, last, epsilon, keep);
+}
+
+// Ramer-Douglas-Peucker on a closed outline, split at the point farthest from the first.
+static Outline simplify(const Outline& points, float epsilon)
+{
+    int count = points.size();
+    int opposite = 0;
+    for (int i = 1; i < count; ++i) {
+        if ((points[i] - points[0]).LengthSquared() > (points[opposite] - points[0]).LengthSquared())
+            opposite = i;
+    }
+
+    std::vector<bool> keep(count, false);
+    keep[0] = keep[opposite] = true;
+    simplifyRange(points, 0, opposite, epsilon, keep);
+    simplifyRange(points, opposite, count, epsilon, keep);
+
+    Outline result;
+    for (int i = 0; i < count; ++i) {
+        if (keep[i])
+            result.push_back(points[i]);
+    }
+    return result;
+}
+
+// The least simplification that fits the budget, by bisecting the tolerance.
+static Outline simplifyToBudget(const Outline& points, int budget)
+{
+    if (static_cast<int>(points.size()) <= budget)
+        return points;
+
+    float low = 0, high = 0;
+    for (unsigned i = 0; i < points.size(); ++i)
+        high = std::max(high, (points[i] - points[0]).Length());
+
+    Outline best = simplify(points, high);
+    for (int i = 0; i < 24; ++i) {
+        float epsilon = (low + high) / 2;
+        Outline candidate = simplify(points, epsilon);
+        if (static_cast<int>(candidate.size()) <= budget) {
+            best = candidate;
+            high = epsilon;
+        } else {
+            low = epsilon;
+        }
+    }
+    return best;
+}
+
+static float cross(const HawkPoint& o, const HawkPoint& a, const HawkPoint& b)
+{
+    return b2Cross(a - o, b - o);
+}
+
+// Removes vertices that barely bend the outline, shallowest first.
+static void pruneShallow(Outline& points, float tolerance)
+{
+    while (points.size() > 3) {
+        int count = points.size();
+        int shallowest = -1;
+        float depth = tolerance;
+        for (int i = 0; i < count; ++i) {
+            float distance = distanceToSegment(points[i], points[(i + count - 1) % count], points[(i + 1) % count]);
+            if (distance < depth) {
+                depth = distance;
+                shallowest = i;
+            }
+        }
+        if (shallowest < 0)
+            return;
+        points.erase(points.begin() + shallowest);
+    }
+}
+
+static float signedArea(const Outline& points)
+{
+    float area = 0;
+    for (unsigned i = 0; i < points.size(); ++i)
+        area += b2Cross(points[i], points[(i + 1) % points.size()]);
+    return area / 2;
+}
+
+// Width of a convex polygon: the least extent across any of its edges.
+static float thickness(const Outline& polygon)
+{
+    int count = polygon.size();
+    float thinnest = FLT_MAX;
+    for (int i = 0; i < count; ++i) {
+        HawkVector edge = polygon[(i + 1) % count] - polygon[i];
+        float length = edge.Length();
+        if (length <= 0)
+            return 0;
+
+        float extent = 0;
+        for (int j = 0; j < count; ++j)
+            extent = std::max(extent, cross(polygon[i], polygon[(i + 1) % count], polygon[j]) / length);
+        thinnest = std::min(thinnest, extent);
+    }
+    return thinnest;
+}
+
+static bool insideTriangle(const HawkPoint& p, const HawkPoint& a, const HawkPoint& b, const HawkPoint& c)
+{
+    return cross(a, b, p) >= 0 && cross(b, c, p) >= 0 && cross(c, a, p) >= 0;
+}
+
+// Ear clipping of a counter-clockwise outline into index triangles.
+static bool triangulate(const Outline& points, Polygons& polygons)
+{
+    std::vector<int> remaining;
+    for (unsigned i = 0; i < points.size(); ++i)
+        remaining.push_back(i);
+
+    while (remaining.size() > 3) {
+        int count = remaining.size();
+        bool clipped = false;
+        for (int i = 0; i < count && !clipped; ++i) {
+            int a = remaining[(i + count - 1) % count], b = remaining[i], c = remaining[(i + 1) % count];
+            if (cross(points[a], points[b], points[c]) <= 0)
+                continue;
+
+            bool ear = true;
+            for (int j = 0; j < count && ear; ++j) {
+                int p = remaining[j];
+                if (p != a && p != b && p != c && insideTriangle(points[p], points[a], points[b], points[c]))
+                    ear = false;
+            }
+            if (!ear)
+                continue;
+
+            std::vector<int> triangle;
+            triangle.push_back(a);
+            triangle.push_back(b);
+            triangle.push_back(c);
+            polygons.push_back(triangle);
+            remaining.erase(remaining.begin() + i);
+            clipped = true;
+        }
+        if (!clipped)
+            return false;
+    }
+
+    if (cross(points[remaining[0]], points[remaining[1]], points[remaining[2]]) > 0)
+        polygons.push_back(remaining);
+    return true;
+}
+
+static bool isConvex(const Outline& points, const std::vector<int>& polygon)
+{
+    int count = polygon.size();
+    for (int i = 0; i < count; ++i) {
+        if (cross(points[polygon[i]], points[polygon[(i + 1) % count]], points[polygon[(i + 2) % count]]) < 0)
+            return false;
+    }
+    return true;
+}
+
+// Joins a and b across their shared edge when the result is convex and small enough.
+static bool tryMerge(const Outline& points, const std::vector<int>& a, const std::vector<int>& b, std::vector<int>& merged)
+{
+    int countA = a.size(), countB = b.size();
+    if (countA + countB - 2 > b2_maxPolygonVertices)
+        return false;
+
+    for (int i = 0; i < countA; ++i) {
+        int from = a[i], to = a[(i + 1) % countA];
+        for (int j = 0; j < countB; ++j) {
+            if (b[j] != to || b[(j + 1) % countB] != from)
+                continue;
+
+            // Walk a from the edge's end round to its start, then b's far side.
+            merged.clear();
+            for (int k = 0; k < countA; ++k)
+                merged.push_back(a[(i + 1 + k) % countA]);
+            for (int k = 2; k < countB; ++k)
+                merged.push_back(b[(j + k) % countB]);
+            return isConvex(points, merged);
+        }
+    }
+    return false;
+}
+
+static void mergeConvex(const Outline& points, Polygons& polygons)
+{
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (unsigned i = 0; i < polygons.size() && !merged; ++i) {
+            for (unsigned j = i + 1; j < polygons.size() && !merged; ++j) {
+                std::vector<int> result;
+                if (tryMerge(points, polygons[i], polygons[j], result)) {
+                    polygons[i] = result;
+                    polygons.erase(polygons.begin() + j);
+                    merged = true;
+                }
+            }
+        }
+    }
+}
+
+// Simplifies the outline to the vertex budget and splits it into convex polygons, leaving out slivers.
+static bool decompose(const Outline& outline, int budget, Outline& simplified, std::vector<Outline>& result)
+{
+    simplified = simplifyToBudget(outline, budget);
+    pruneShallow(simplified, MinThickness);
+    if (signedArea(simplified) < 0)
+        std::reverse(simplified.begin(), simplified.end());
+
+    Polygons polygons;
+    if (simplified.size() < 3 || !triangulate(simplified, polygons))
+        return false;
+    mergeConvex(simplified, polygons);
+
+    result.clear();
+    for (unsigned i = 0; i < polygons.size(); ++i) {
+        Outline polygon;
+        for (unsigned v = 0; v < polygons[i].size(); ++v)
+            polygon.push_back(simplified[polygons[i][v]]);
+
+        if (signedArea(polygon) >= MinArea && thickness(polygon) >= MinThickness)
+            result.push_back(polygon);
+    }
+    return true;
+}
+
+static bool traceFile(const char* path, int threshold, int budget, int polygonBudget, bool quiet)
+{
+    AlphaImage image;
+    if (!readAlpha(path, image))
+        return false;
+
+    Outline outline;
+    if (!traceOutline(image, threshold, outline)) {
+        fprintf(stderr, "%s: no opaque region\n", path);
+        return false;
+    }
+
+    // Sprites are drawn centred and y up; the image is y down.
+    for (unsigned i = 0; i < outline.size(); ++i)
+        outline[i] = HawkPoint(outline[i].x - image.width / 2.f, image.height / 2.f - outline[i].y);
+
+    // Fewer vertices give fewer polygons; keep the most detail that fits both budgets.
+    Outline simplified;
+    std::vector<Outline> polygons;
+    for (int vertices = budget; vertices >= 3; --vertices) {
+        if (!decompose(outline, vertices, simplified, polygons)) {
+            fprintf(stderr, "%s: outline could not be decomposed\n", path);
+            return false;
+        }
+        if (static_cast<int>(polygons.size()) <= polygonBudget)
+            break;
+    }
+    if (polygons.empty() || static_cast<int>(polygons.size()) > polygonBudget) {
+        fprintf(stderr, "%s: no decomposition within %d polygons\n", path, polygonBudget);
+        return false;
+    }
+
+    SpriteShape shape;
+    shape.setSize(image.width, image.height);
+    for (unsigned i = 0; i < polygons.size(); ++i)
+        shape.addPolygon(&polygons[i][0], polygons[i].size());
+
+    std::string output = SpriteShape::pathFor(path);
+    if (!shape.save(output.c_str())) {
+        fprintf(stderr, "Cannot write %s\n", output.c_str());
+        return false;
+    }
+
+    if (!quiet) {
+        printf("%s: %dx%d, outline %u -> %u vertices, %d polygons, area %.0f of %d\n", output.c_str(), image.width, image.height,
+            static_cast<unsigned>(outline.size()), static_cast<unsigned>(simplified.size()), shape.polygonCount(),
+            signedArea(simplified), image.width * image.height);
+    }
+    return true;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: shapetracer [-a alpha] [-v vertices] [-p polygons] [-q] image.png...\n");
+}
+
+int main(int argc, char** argv)
+{
+    int threshold = 127;
+    int budget = 16;
+    int polygonBudget = 4;
+    bool quiet = false;
+
+    int option;
+    while ((option = getopt(argc, argv, "a:v:p:q")) != -1) {
+        switch (option) {
+        case 'a':
+            threshold = atoi(optarg);
+            break;
+        case 'v':
+            budget = std::max(3, atoi(optarg));
+            break;
+        case 'p':
+            polygonBudget = std::max(1, atoi(optarg));
+            break;
+        case 'q':
+            quiet = true;
+            break;
+        default:
+            usage();
+            return 2;
+        }
+    }
+    if (optind == argc) {
+        usage();
+        return 2;
+    }
+
+    int failures = 0;
+    for (int i = optind; i < argc; ++i)
+        failures += !traceFile(argv[i], threshold, budget, polygonBudget, quiet);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,13 @@
+/*
+ * EGL/egl.h
+ *
+ * Headless stand-in for EGL. The tools never create a display or surface.
+ */
+
+#ifndef HEADLESS_EGL_H_
+#define HEADLESS_EGL_H_
+
+typedef void* EGLDisplay;
+typedef void* EGLSurface;
+
+#endif /* HEADLESS_EGL_H_ */
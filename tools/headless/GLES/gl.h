@@ -0,0 +1,37 @@
+/*
+ * GLES/gl.h
+ *
+ * Headless stand-in for OpenGL ES 1.x. Only the types Sprite.h uses and the
+ * calls ParticleSystem::draw() makes are provided; the calls do nothing and
+ * HeadlessSprite.cpp never touches GL.
+ */
+
+#ifndef HEADLESS_GL_H_
+#define HEADLESS_GL_H_
+
+typedef float GLfloat;
+typedef unsigned int GLuint;
+typedef unsigned char GLubyte;
+typedef unsigned int GLenum;
+typedef int GLint;
+typedef int GLsizei;
+
+#define GL_FLOAT 0x1406
+#define GL_POINTS 0x0000
+#define GL_TEXTURE_2D 0x0DE1
+#define GL_TEXTURE_COORD_ARRAY 0x8078
+
+inline void glEnable(GLenum) { }
+inline void glDisable(GLenum) { }
+inline void glEnableClientState(GLenum) { }
+inline void glDisableClientState(GLenum) { }
+inline void glPushMatrix() { }
+inline void glPopMatrix() { }
+inline void glScalef(GLfloat, GLfloat, GLfloat) { }
+inline void glPointSize(GLfloat) { }
+inline void glColor4ub(GLubyte, GLubyte, GLubyte, GLubyte) { }
+inline void glColor4f(GLfloat, GLfloat, GLfloat, GLfloat) { }
+inline void glVertexPointer(GLint, GLenum, GLsizei, const void*) { }
+inline void glDrawArrays(GLenum, GLint, GLsizei) { }
+
+#endif /* HEADLESS_GL_H_ */
@@ -0,0 +1,85 @@
+/*
+ * HeadlessSprite.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Sprite implementation for the desktop tools. Textures are never uploaded;
+ * load() only reads the PNG header so sprite sizes, and therefore the fixtures
+ * created from them, match the game exactly.
+ */
+
+#include "Sprite.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static bool readPngSize(const char* filename, int& width, int& height)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+    FILE* file = fopen(filename, "rb");
+    if (!file)
+        return false;
+
+    // Signature, IHDR length and type, then big-endian width and height.
+    unsigned char header[24];
+    size_t read = fread(header, 1, sizeof(header), file);
+    fclose(file);
+
+    if (read != sizeof(header) || memcmp(header, signature, sizeof(signature)) || memcmp(header + 12, "IHDR", 4))
+        return false;
+
+    width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+    height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+    return true;
+}
+
+Sprite::Sprite()
+    : m_textureHandle(0)
+    , m_width(0)
+    , m_height(0)
+    , m_posX(0)
+    , m_posY(0)
+{
+    for (int i = 0; i < 8; i++) {
+        m_vertices[i] = 0.0f;
+        m_textureCoordinates[i] = 0.0f;
+    }
+}
+
+Sprite::~Sprite()
+{
+}
+
+bool Sprite::load(const char* filename)
+{
+    int sizeX, sizeY;
+    if (!readPngSize(filename, sizeX, sizeY)) {
+        fprintf(stderr, "Unable to read sprite size from %s\n", filename);
+        return false;
+    }
+
+    m_width = static_cast<float>(sizeX);
+    m_height = static_cast<float>(sizeY);
+    return true;
+}
+
+void Sprite::setPosition(float x, float y)
+{
+    m_posX = x;
+    m_posY = y;
+}
+
+void Sprite::setSize(float w, float h)
+{
+    m_width = w;
+    m_height = h;
+}
+
+void Sprite::draw() const
+{
+}
+
+void Sprite::drawTriangles(const GLfloat*, const GLfloat*, int) const
+{
+}
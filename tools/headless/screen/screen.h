@@ -0,0 +1,14 @@
+/*
+ * screen/screen.h
+ *
+ * Headless stand-in for the QNX screen API so the engine sources build for
+ * the desktop tools. Only the types bbutil.h names are provided.
+ */
+
+#ifndef HEADLESS_SCREEN_H_
+#define HEADLESS_SCREEN_H_
+
+typedef void* screen_context_t;
+typedef void* screen_window_t;
+
+#endif /* HEADLESS_SCREEN_H_ */
@@ -0,0 +1,5 @@
+/*
+ * sys/platform.h
+ *
+ * Headless stand-in for the QNX platform header. Intentionally empty.
+ */